@@ -0,0 +1,141 @@
+/**
+ * @file I2C_CLOCK.c
+ *
+ * @author ClefaMedia
+ *
+ * @version 1.0
+ *
+ * @copyright
+ * Copyright (C) ClefaMedia 2021. 
+ * All Rights GNU GLP Licensed.
+ *
+ * @brief This library was created to run a clock face with big numbers (I2C_LCD_DN)
+ * from the 1Hz square wave of the RTC (I2C_RTC).
+ * 
+ * The SQW pin of the RTC is connected to INT0 (PD2). The interrupt only
+ * counts the edges, all I2C work is done in I2C_CLOCK_task:
+ * + the colon follows the square wave (on for 500ms, off for 500ms)
+ * + the software clock of I2C_RTC is advanced with every second and the
+ *   changed numbers are drawn once per minute, the RTC is only read
+ *   for a resync every I2C_CLOCK_RESYNC minutes
+ * + "--:--" is shown while the RTC lost the time (oscillator stop flag),
+ *   the time set with I2C_RTC_setDateTime is shown within a second
+ * 
+ * This library uses the INT0 interrupt vector.
+ */
+
+
+#include "I2C_CLOCK.h"
+#include "I2C_LCD_DN.h"
+#include "I2C_RTC.h"
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+
+// queued work for I2C_CLOCK_task
+#define CLOCK_COLON     0x01            // colon has to follow the square wave
+#define CLOCK_REFRESH   0x02            // time has to be read and drawn
+
+static volatile uint8_t clock_pending;  // queued work (bitmask)
+
+ISR(INT0_vect)
+{
+    if (!(I2C_CLOCK_SQW_PIN & (1 << I2C_CLOCK_SQW_BIT)))    // falling edge: next second
+    {
+        if (I2C_RTC_clockTick())
+        {
+            clock_pending |= CLOCK_REFRESH;                 // new minute
+        }
+    }
+    clock_pending |= CLOCK_COLON;
+}
+
+// resync the software clock if due and draw the changed numbers
+static void I2C_CLOCK_draw(void)
+{
+    struct rtc_datetime now;
+
+    I2C_RTC_clockTask();                // reads the RTC only every I2C_CLOCK_RESYNC minutes
+    I2C_RTC_clockGet(&now);
+    if (I2C_RTC_timeValid(&now))
+    {
+        I2C_LCD_DN_showTime(now.hour, now.min);
+    }
+    else
+    {
+        I2C_LCD_DN_showNoTime();        // RTC lost the time, until it is set again
+    }
+}
+
+void I2C_CLOCK_init(void)
+{
+    I2C_RTC_setSQW(0x00);               // 1Hz square wave
+    I2C_RTC_clockInit(I2C_CLOCK_RESYNC);    // software clock advanced by the falling edges
+
+    I2C_CLOCK_SQW_DDR &= ~(1 << I2C_CLOCK_SQW_BIT);    // input
+    I2C_CLOCK_SQW_PORT |= (1 << I2C_CLOCK_SQW_BIT);    // pull-up for the open drain output
+    EICRA = (EICRA & ~((1 << ISC01) | (1 << ISC00))) | (1 << ISC00);    // interrupt on both edges
+    EIFR = (1 << INTF0);                // clear old interrupt
+    EIMSK |= (1 << INT0);               // enable interrupt
+
+    I2C_CLOCK_draw();
+}
+
+void I2C_CLOCK_refresh(void)
+{
+    I2C_RTC_clockResync();
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        clock_pending |= CLOCK_REFRESH;
+    }
+}
+
+void I2C_CLOCK_task(void)
+{
+    uint8_t pending;
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        pending = clock_pending;        // take the queued work
+        clock_pending = 0;
+    }
+
+    if (pending & CLOCK_COLON)          // colon is on while the square wave is high
+    {
+        if (I2C_RTC_clockTask())        // resync requested, f.e. by I2C_RTC_setDateTime
+        {
+            pending |= CLOCK_REFRESH;   // show the new time within a second, not with the next minute
+        }
+        uint8_t state = (I2C_CLOCK_SQW_PIN & (1 << I2C_CLOCK_SQW_BIT)) ? 1 : 0;
+        if (state != colonState)
+        {
+            if (state)
+            {
+                I2C_LCD_DN_printColon();
+            }
+            else
+            {
+                I2C_LCD_DN_clearColon();
+            }
+        }
+    }
+    if (pending & CLOCK_REFRESH)
+    {
+        I2C_CLOCK_draw();
+    }
+}
+
+/**
+ * This file is part of I2C_CLOCK Library
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
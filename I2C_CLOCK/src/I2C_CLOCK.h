@@ -0,0 +1,90 @@
+/**
+ * @file I2C_CLOCK.h
+ *
+ * @author ClefaMedia
+ *
+ * @version 1.0
+ *
+ * @copyright
+ * Copyright (C) ClefaMedia 2021. 
+ * All Rights GNU GLP Licensed.
+ *
+ * @brief This library was created to run a clock face with big numbers (I2C_LCD_DN)
+ * from the 1Hz square wave of the RTC (I2C_RTC).
+ * 
+ * The SQW pin of the RTC is connected to INT0 (PD2). The interrupt only
+ * counts the edges, all I2C work is done in I2C_CLOCK_task:
+ * + the colon follows the square wave (on for 500ms, off for 500ms)
+ * + the software clock of I2C_RTC is advanced with every second and the
+ *   changed numbers are drawn once per minute, the RTC is only read
+ *   for a resync every I2C_CLOCK_RESYNC minutes
+ * + "--:--" is shown while the RTC lost the time (oscillator stop flag),
+ *   the time set with I2C_RTC_setDateTime is shown within a second
+ * 
+ * This library uses the INT0 interrupt vector.
+ */
+
+
+#ifndef _I2C_CLOCK_H                    // prevents duplicate
+#define _I2C_CLOCK_H   1                // forward declarations
+
+#include <avr/io.h>                     // requires AVR Input/Output
+#include <inttypes.h>                   // requires Inttypes
+
+// SQW input (INT0)
+#define I2C_CLOCK_SQW_DDR   DDRD
+#define I2C_CLOCK_SQW_PORT  PORTD
+#define I2C_CLOCK_SQW_PIN   PIND
+#define I2C_CLOCK_SQW_BIT   PD2
+
+// minutes between two reads of the RTC
+#ifndef I2C_CLOCK_RESYNC
+#define I2C_CLOCK_RESYNC    60
+#endif
+
+/** ===================================================
+ * @brief function to start the clock face
+ * + set the RTC square wave to 1Hz
+ * + enable the interrupt on both edges of INT0
+ * + start the software clock and draw the numbers
+ * 
+ * The I2C-Bus and the display (I2C_LCD_DN_init)
+ * must be initialized before.
+ * Global interrupts must be enabled with sei().
+ */
+void I2C_CLOCK_init(void);
+
+/** ===================================================
+ * @brief function to do the queued work of the interrupt.
+ * Has to be called in the main loop, 
+ * returns at once if nothing is queued.
+ */
+void I2C_CLOCK_task(void);
+
+/** ===================================================
+ * @brief function to resync with the RTC and redraw 
+ * the changed numbers with the next I2C_CLOCK_task,
+ * f.e. after the RTC was set without I2C_RTC (the set
+ * functions of I2C_RTC request the resync themselves)
+ */
+void I2C_CLOCK_refresh(void);
+
+#endif                               // end prevent duplicate forward
+/* _I2C_CLOCK_H */                   // declarations block
+
+/**
+ * This file is part of I2C_CLOCK Library
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
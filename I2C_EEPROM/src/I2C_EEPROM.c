@@ -0,0 +1,172 @@
+/**
+ * @file I2C_EEPROM.c
+ *
+ * @author ClefaMedia
+ *
+ * @version 1.0
+ *
+ * @copyright
+ * Copyright (C) ClefaMedia 2021.
+ * All Rights GNU GLP Licensed.
+ *
+ * @brief This library was created to store data in an AT24C32
+ * (or another AT24Cxx with 2 address bytes) on the I2C-Bus,
+ * f.e. the EEPROM on the DS3231 modules (ZS-042, address 0x57).
+ *
+ * Writes are split at the page boundaries, every page is one transaction.
+ * After a page the EEPROM is busy with its write cycle (up to 10ms) and
+ * does not acknowledge its address. Instead of a fixed delay the next
+ * access polls the address until it is acknowledged (bounded by
+ * I2C_EEPROM_POLLS), so the program only waits as long as the EEPROM
+ * really needs and not at all after the last page.
+ * Reads of any length are one sequential read in one transaction.
+ */
+
+
+#include "I2C_EEPROM.h"
+#include <I2C.h>
+#include <util/delay.h>
+
+// ACK polling until the write cycle is finished, the connection stays open on success
+static uint8_t I2C_EEPROM_poll(void)
+{
+    for (uint16_t i = 0; i < I2C_EEPROM_POLLS; i++)
+    {
+        if (!I2C_start(I2C_EEPROM_ADDRESS | I2C_WRITE))
+        {
+            return 0;                   // address acknowledged, connection stays open
+        }
+        I2C_stop();                     // busy with the write cycle
+        _delay_us(I2C_EEPROM_POLL_US);
+    }
+    return 1;
+}
+
+// poll the address until the write cycle is finished and send the memory address
+static uint8_t I2C_EEPROM_select(uint16_t address)
+{
+    if (I2C_EEPROM_poll())
+    {
+        return 1;
+    }
+    if (I2C_write(address >> 8) || I2C_write(address & 0xFF))
+    {
+        I2C_stop();
+        return 1;
+    }
+    return 0;
+}
+
+// 1 if the bytes do not fit behind the address, the EEPROM would wrap to address 0
+static uint8_t I2C_EEPROM_outside(uint16_t address, uint16_t length)
+{
+    return (address >= I2C_EEPROM_SIZE) || (length > I2C_EEPROM_SIZE - address);
+}
+
+// sequential read, every byte goes to put or into data
+static uint8_t I2C_EEPROM_sequential(uint16_t address, uint8_t *data, uint16_t length, void (*put)(uint8_t))
+{
+    if (I2C_EEPROM_outside(address, length))
+    {
+        return 1;
+    }
+    if (!length)
+    {
+        return 0;
+    }
+    if (I2C_EEPROM_select(address))
+    {
+        return 1;
+    }
+    if (I2C_repStart(I2C_EEPROM_ADDRESS | I2C_READ))
+    {
+        I2C_stop();
+        return 1;
+    }
+    while (length--)
+    {
+        uint8_t value = I2C_read(length ? I2C_ACK : I2C_NAK);  // NAK ends the read
+        if (put)
+        {
+            put(value);
+        }
+        else
+        {
+            *data++ = value;
+        }
+    }
+    I2C_stop();
+    return 0;
+}
+
+uint8_t I2C_EEPROM_wait(void)
+{
+    if (I2C_EEPROM_poll())
+    {
+        return 1;
+    }
+    I2C_stop();                         // only the ready state is asked for
+    return 0;
+}
+
+uint8_t I2C_EEPROM_write(uint16_t address, const uint8_t *data, uint16_t length)
+{
+    if (I2C_EEPROM_outside(address, length))
+    {
+        return 1;                       // nothing is written
+    }
+    while (length)
+    {
+        // bytes up to the end of the page, the address counter wraps within a page
+        uint8_t count = I2C_EEPROM_PAGE - (address & (I2C_EEPROM_PAGE - 1));
+        if (count > length)
+        {
+            count = length;
+        }
+
+        if (I2C_EEPROM_select(address))
+        {
+            return 1;
+        }
+        for (uint8_t i = 0; i < count; i++)
+        {
+            if (I2C_write(*data++))
+            {
+                I2C_stop();
+                return 1;
+            }
+        }
+        I2C_stop();                     // starts the write cycle of the page
+
+        address += count;
+        length -= count;
+    }
+    return 0;
+}
+
+uint8_t I2C_EEPROM_read(uint16_t address, uint8_t *data, uint16_t length)
+{
+    return I2C_EEPROM_sequential(address, data, length, 0);
+}
+
+uint8_t I2C_EEPROM_readPut(uint16_t address, uint16_t length, void (*put)(uint8_t))
+{
+    return I2C_EEPROM_sequential(address, 0, length, put);
+}
+
+/**
+ * This file is part of I2C_EEPROM Library
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
@@ -0,0 +1,121 @@
+/**
+ * @file I2C_EEPROM.h
+ *
+ * @author ClefaMedia
+ *
+ * @version 1.0
+ *
+ * @copyright
+ * Copyright (C) ClefaMedia 2021.
+ * All Rights GNU GLP Licensed.
+ *
+ * @brief This library was created to store data in an AT24C32
+ * (or another AT24Cxx with 2 address bytes) on the I2C-Bus,
+ * f.e. the EEPROM on the DS3231 modules (ZS-042, address 0x57).
+ *
+ * Writes are split at the page boundaries, every page is one transaction.
+ * After a page the EEPROM is busy with its write cycle (up to 10ms) and
+ * does not acknowledge its address. Instead of a fixed delay the next
+ * access polls the address until it is acknowledged (bounded by
+ * I2C_EEPROM_POLLS), so the program only waits as long as the EEPROM
+ * really needs and not at all after the last page.
+ * Reads of any length are one sequential read in one transaction.
+ */
+
+
+#ifndef _I2C_EEPROM_H                   // prevents duplicate
+#define _I2C_EEPROM_H   1               // forward declarations
+
+#include <avr/io.h>                     // requires AVR Input/Output
+#include <inttypes.h>                   // requires Inttypes
+
+// I2C address of the EEPROM (A0 - A2 high on the ZS-042: 0x57)
+#ifndef I2C_EEPROM_ADDRESS
+#define I2C_EEPROM_ADDRESS      0xAE
+#endif
+
+// page size in bytes (AT24C32 / AT24C64: 32, AT24C128 / AT24C256: 64)
+#ifndef I2C_EEPROM_PAGE
+#define I2C_EEPROM_PAGE         32
+#endif
+
+// size in bytes (AT24C32: 4096)
+#ifndef I2C_EEPROM_SIZE
+#define I2C_EEPROM_SIZE         4096
+#endif
+
+// max. polls of the address while a write cycle runs, with I2C_EEPROM_POLL_US
+// between them (more than 10ms together at every bus speed)
+#define I2C_EEPROM_POLLS        250
+#define I2C_EEPROM_POLL_US      50
+
+#if (I2C_EEPROM_PAGE & (I2C_EEPROM_PAGE - 1))
+#error "I2C_EEPROM_PAGE must be a power of 2"
+#endif
+
+/** ===================================================
+ * @brief function to wait until a running write cycle is finished
+ * (ACK polling), the bus is released again with a STOP.
+ * Not needed before the other functions, they poll, too.
+ *
+ * The I2C-Bus must be initialized before.
+ *
+ * @return 0 the EEPROM is ready, 1 it did not answer within I2C_EEPROM_POLLS
+ */
+uint8_t I2C_EEPROM_wait(void);
+
+/** ===================================================
+ * @brief function to write bytes, split at the page boundaries.
+ * Returns after the last page was sent, its write cycle
+ * runs while the program continues.
+ *
+ * @param address first address 0 - I2C_EEPROM_SIZE - 1
+ * @param data bytes to write
+ * @param length number of bytes
+ * @return 0 on success, 1 if the EEPROM does not answer
+ * or address + length is above I2C_EEPROM_SIZE
+ */
+uint8_t I2C_EEPROM_write(uint16_t address, const uint8_t *data, uint16_t length);
+
+/** ===================================================
+ * @brief function to read bytes in one sequential read
+ *
+ * @param address first address 0 - I2C_EEPROM_SIZE - 1
+ * @param data array for the bytes
+ * @param length number of bytes
+ * @return 0 on success, 1 if the EEPROM does not answer
+ * or address + length is above I2C_EEPROM_SIZE
+ */
+uint8_t I2C_EEPROM_read(uint16_t address, uint8_t *data, uint16_t length);
+
+/** ===================================================
+ * @brief function to send bytes in one sequential read
+ * straight to a function without an array, f.e. a dump to the UART
+ *
+ * @param address first address 0 - I2C_EEPROM_SIZE - 1
+ * @param length number of bytes
+ * @param put function called with every byte
+ * @return 0 on success, 1 if the EEPROM does not answer
+ * or address + length is above I2C_EEPROM_SIZE
+ */
+uint8_t I2C_EEPROM_readPut(uint16_t address, uint16_t length, void (*put)(uint8_t));
+
+#endif                               // end prevent duplicate forward
+/* _I2C_EEPROM_H */                  // declarations block
+
+/**
+ * This file is part of I2C_EEPROM Library
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
@@ -17,8 +17,21 @@
 
 #include "I2C_LCD.h"        // requires I2C_LCD
 #include <util/delay.h>     // requires Util delay
+#include <avr/pgmspace.h>   // requires program space
 #include <I2C.h>            // requires I2C by clefa
 
+// powers of ten used for the digit extraction
+static const uint32_t I2C_LCD_pow10[10] PROGMEM = {
+    1UL, 10UL, 100UL, 1000UL, 10000UL,
+    100000UL, 1000000UL, 10000000UL, 100000000UL, 1000000000UL
+};
+
+// glyph manager storage
+static const uint8_t *glyph_id[I2C_LCD_GLYPH_SLOTS];        // PROGMEM bitmap in each location
+static uint8_t glyph_visible[I2C_LCD_GLYPH_SLOTS];          // number of visible cells per location
+static uint8_t glyph_lru[I2C_LCD_GLYPH_SLOTS] = {0, 1, 2, 3, 4, 5, 6, 7};  // most -> least recently used
+static uint8_t glyph_pinned;                                // locations not managed (bitmask)
+
 void I2C_LCD_push(uint8_t i2c_data)
 {
     // command with Enable HIGH
@@ -106,6 +119,135 @@ void I2C_LCD_printChar(char c)
     I2C_stop();    // stop I2C connection
 }
 
+uint8_t I2C_LCD_decimalLength(uint32_t value)
+{
+    uint8_t len = 1;
+    // count the powers of ten which are not bigger than the value
+    while ((len < 10) && (value >= pgm_read_dword(&I2C_LCD_pow10[len])))
+    {
+        len++;
+    }
+    return len;
+}
+
+uint8_t I2C_LCD_decimalDigit(uint32_t *value, uint8_t place)
+{
+    uint32_t p = pgm_read_dword(&I2C_LCD_pow10[place]);
+    uint8_t digit = 0;
+    // subtract the power of ten max. 9 times instead of dividing
+    while (*value >= p)
+    {
+        *value -= p;
+        digit++;
+    }
+    return digit;
+}
+
+// write the same character n times
+static void I2C_LCD_writeRepeat(uint8_t c, uint8_t n)
+{
+    while (n--)
+    {
+        I2C_LCD_write(c);
+    }
+}
+
+void I2C_LCD_writeNumber(uint32_t value, uint8_t negative, uint8_t decimals, uint8_t width, uint8_t flags)
+{
+    if (decimals > 9)                           // max. place in the table of the powers of ten
+    {
+        decimals = 9;
+    }
+    uint8_t digits = I2C_LCD_decimalLength(value);
+    if (digits <= decimals)                     // keep one zero in front of the point
+    {
+        digits = decimals + 1;
+    }
+    uint8_t len = digits + (decimals ? 1 : 0) + (negative ? 1 : 0);
+    uint8_t pad = (width > len) ? (width - len) : 0;
+
+    if (!(flags & (I2C_LCD_ALIGN_LEFT | I2C_LCD_PAD_ZERO)))
+    {
+        I2C_LCD_writeRepeat(' ', pad);          // right aligned with spaces
+    }
+    if (negative)
+    {
+        I2C_LCD_write('-');
+    }
+    if ((flags & (I2C_LCD_ALIGN_LEFT | I2C_LCD_PAD_ZERO)) == I2C_LCD_PAD_ZERO)
+    {
+        I2C_LCD_writeRepeat('0', pad);          // right aligned with zeros behind the sign
+    }
+    while (digits--)                            // send digits from the highest place down
+    {
+        if (decimals && (digits == decimals - 1))
+        {
+            I2C_LCD_write('.');
+        }
+        I2C_LCD_write('0' + I2C_LCD_decimalDigit(&value, digits));
+    }
+    if (flags & I2C_LCD_ALIGN_LEFT)
+    {
+        I2C_LCD_writeRepeat(' ', pad);          // left aligned
+    }
+}
+
+void I2C_LCD_writeHex(uint32_t value, uint8_t width, uint8_t flags)
+{
+    uint8_t digits = 8;
+    // shift leading zero nibbles out, keep at least one digit
+    while ((digits > 1) && !(value & 0xF0000000UL))
+    {
+        value <<= 4;
+        digits--;
+    }
+    uint8_t pad = (width > digits) ? (width - digits) : 0;
+
+    if (!(flags & I2C_LCD_ALIGN_LEFT))
+    {
+        I2C_LCD_writeRepeat((flags & I2C_LCD_PAD_ZERO) ? '0' : ' ', pad);
+    }
+    while (digits--)                            // send nibbles from the highest down
+    {
+        uint8_t nibble = value >> 28;
+        I2C_LCD_write(nibble + ((nibble < 10) ? '0' : ('A' - 10)));
+        value <<= 4;
+    }
+    if (flags & I2C_LCD_ALIGN_LEFT)
+    {
+        I2C_LCD_writeRepeat(' ', pad);
+    }
+}
+
+void I2C_LCD_printUInt(uint32_t value, uint8_t width, uint8_t flags)
+{
+    I2C_startWait(I2C_LCD_ADDRESS & ~I2C_WRITE);   // start I2C connection to LCD
+    I2C_LCD_writeNumber(value, 0, 0, width, flags);     // send number as data
+    I2C_stop();    // stop I2C connection
+}
+
+void I2C_LCD_printInt(int32_t value, uint8_t width, uint8_t flags)
+{
+    I2C_LCD_printFixed(value, 0, width, flags);
+}
+
+void I2C_LCD_printFixed(int32_t value, uint8_t decimals, uint8_t width, uint8_t flags)
+{
+    uint8_t negative = (value < 0);
+    uint32_t magnitude = negative ? (0UL - (uint32_t)value) : (uint32_t)value;
+
+    I2C_startWait(I2C_LCD_ADDRESS & ~I2C_WRITE);   // start I2C connection to LCD
+    I2C_LCD_writeNumber(magnitude, negative, decimals, width, flags);   // send number as data
+    I2C_stop();    // stop I2C connection
+}
+
+void I2C_LCD_printHex(uint32_t value, uint8_t width, uint8_t flags)
+{
+    I2C_startWait(I2C_LCD_ADDRESS & ~I2C_WRITE);   // start I2C connection to LCD
+    I2C_LCD_writeHex(value, width, flags);              // send number as data
+    I2C_stop();    // stop I2C connection
+}
+
 void I2C_LCD_setRowOffsets(uint8_t row1, uint8_t row2, uint8_t row3, uint8_t row4)
 {
     row_offsets[0] = row1;  // row 1 start address
@@ -222,6 +364,8 @@ void I2C_LCD_cursorFixPosition(uint8_t state) {
 // with custom characters
 void I2C_LCD_createChar(uint8_t location, uint8_t charmap[]) {
     location &= 0x7;    // limit location to 4 bit (8 locations)
+    glyph_id[location] = 0;                 // location is no longer managed
+    glyph_pinned |= (1 << location);
     I2C_startWait(I2C_LCD_ADDRESS & ~I2C_WRITE);               // start I2C connection to LCD
     I2C_LCD_command4bit(I2C_LCD_SETCGRAMADDR | (location << 3));    // send set CGram + ram address
     for (uint8_t i=0; i<8; i++) {           // loop though the character lines
@@ -230,6 +374,190 @@ void I2C_LCD_createChar(uint8_t location, uint8_t charmap[]) {
     I2C_stop();    // stop I2C connection to LCD
 }
 
+// upload a bitmap from the program memory without changing the glyph manager
+static void I2C_LCD_uploadChar_P(uint8_t location, const uint8_t *charmap) {
+    I2C_startWait(I2C_LCD_ADDRESS & ~I2C_WRITE);               // start I2C connection to LCD
+    I2C_LCD_command4bit(I2C_LCD_SETCGRAMADDR | (location << 3));    // send set CGram + ram address
+    for (uint8_t i=0; i<8; i++) {           // loop though the character lines
+        I2C_LCD_write(pgm_read_byte(&charmap[i]) & 0x1F);   // mask each line to 5 bit
+    }
+    I2C_stop();    // stop I2C connection to LCD
+}
+
+void I2C_LCD_createChar_P(uint8_t location, const uint8_t *charmap) {
+    location &= 0x7;    // limit location to 4 bit (8 locations)
+    glyph_id[location] = 0;                 // location is no longer managed
+    glyph_pinned |= (1 << location);
+    I2C_LCD_uploadChar_P(location, charmap);
+}
+
+void I2C_LCD_createChars_P(uint8_t location, uint8_t count, const uint8_t *charmaps) {
+    location &= 0x7;    // limit location to 4 bit (8 locations)
+    count = (count > 8 - location) ? (8 - location) : count;   // limit to the available locations
+    for (uint8_t i=0; i<count; i++) {
+        glyph_id[location + i] = 0;         // locations are no longer managed
+        glyph_pinned |= (1 << (location + i));
+    }
+    I2C_startWait(I2C_LCD_ADDRESS & ~I2C_WRITE);               // start I2C connection to LCD
+    I2C_LCD_command4bit(I2C_LCD_SETCGRAMADDR | (location << 3));    // send set CGram + ram address
+    for (uint8_t i=0; i<(count << 3); i++) {    // the CGRAM address is incremented by the LCD
+        I2C_LCD_write(pgm_read_byte(&charmaps[i]) & 0x1F);  // mask each line to 5 bit
+    }
+    I2C_stop();    // stop I2C connection to LCD
+}
+
+// move a location to the front of the LRU list
+static void I2C_LCD_glyphTouch(uint8_t location) {
+    uint8_t i = 0;
+    while (glyph_lru[i] != location) {      // find the location in the list
+        i++;
+    }
+    for (; i > 0; i--) {                    // shift the more recently used ones back
+        glyph_lru[i] = glyph_lru[i-1];
+    }
+    glyph_lru[0] = location;
+}
+
+// find the least recently used location which is not visible and not pinned
+static uint8_t I2C_LCD_glyphVictim(void) {
+    for (uint8_t i = I2C_LCD_GLYPH_SLOTS; i > 0; i--) {
+        uint8_t location = glyph_lru[i-1];
+        if (!glyph_visible[location] && !(glyph_pinned & (1 << location))) {
+            return location;
+        }
+    }
+    return I2C_LCD_GLYPH_NONE;
+}
+
+uint8_t I2C_LCD_glyphRequest(const uint8_t *bitmap) {
+    uint8_t location;
+    for (location = 0; location < I2C_LCD_GLYPH_SLOTS; location++) {
+        if (glyph_id[location] == bitmap) {     // already in the CGRAM, no upload
+            I2C_LCD_glyphTouch(location);
+            return location;
+        }
+    }
+    location = I2C_LCD_glyphVictim();
+    if (location != I2C_LCD_GLYPH_NONE) {
+        I2C_LCD_uploadChar_P(location, bitmap); // replace the old glyph
+        glyph_id[location] = bitmap;
+        I2C_LCD_glyphTouch(location);
+    }
+    return location;
+}
+
+uint8_t I2C_LCD_glyphAlloc(void) {
+    uint8_t location = I2C_LCD_glyphVictim();
+    if (location != I2C_LCD_GLYPH_NONE) {
+        glyph_id[location] = 0;
+        glyph_pinned |= (1 << location);    // remove location from the glyph manager
+    }
+    return location;
+}
+
+void I2C_LCD_glyphFree(uint8_t location) {
+    location &= 0x7;
+    glyph_pinned &= ~(1 << location);       // give location back to the glyph manager
+}
+
+void I2C_LCD_glyphShow(uint8_t location) {
+    location &= 0x7;
+    glyph_visible[location]++;
+}
+
+void I2C_LCD_glyphHide(uint8_t location) {
+    location &= 0x7;
+    if (glyph_visible[location]) {
+        glyph_visible[location]--;
+    }
+}
+
+void I2C_LCD_glyphReset(void) {
+    for (uint8_t i = 0; i < I2C_LCD_GLYPH_SLOTS; i++) {
+        glyph_id[i] = 0;
+        glyph_visible[i] = 0;
+        glyph_lru[i] = i;
+    }
+}
+
+uint8_t I2C_LCD_animInit(struct I2C_LCD_anim *anim) {
+    anim->location[0] = I2C_LCD_glyphAlloc();   // reserve front location
+    if (anim->location[0] == I2C_LCD_GLYPH_NONE) {
+        return 1;   // ERROR
+    }
+    anim->location[1] = I2C_LCD_glyphAlloc();   // reserve back location
+    if (anim->location[1] == I2C_LCD_GLYPH_NONE) {
+        I2C_LCD_glyphFree(anim->location[0]);
+        return 1;   // ERROR
+    }
+    anim->front = 0;
+    anim->numcells = 0;
+    anim->frame[0] = 0xFF;  // impossible line, the first frame is always sent
+    return 0;       // SUCCESS
+}
+
+void I2C_LCD_animPlace(struct I2C_LCD_anim *anim, uint8_t col, uint8_t row) {
+    if (anim->numcells >= I2C_LCD_ANIM_CELLS) {
+        return;
+    }
+    col = (col >= numcols) ? numcols : col;         // limit to initialized cols
+    row = (row >= numlines) ? numlines : row;       // limit to initialized lines
+    uint8_t address = (col-1) + row_offsets[row-1];
+    anim->cells[anim->numcells++] = address;        // remember the cell for the next frames
+
+    I2C_startWait(I2C_LCD_ADDRESS & ~I2C_WRITE);               // start I2C connection to LCD
+    I2C_LCD_command4bit(I2C_LCD_SETDDRAMADDR | address);            // send row/col address
+    // blank until the first frame, the location still holds an old glyph
+    I2C_LCD_write((anim->frame[0] == 0xFF) ? ' ' : anim->location[anim->front]);
+    I2C_stop();    // stop I2C connection to LCD
+}
+
+// send a frame to the hidden location and switch all cells to it
+static void I2C_LCD_animSwap(struct I2C_LCD_anim *anim, const uint8_t *charmap, uint8_t progmem) {
+    uint8_t changed = 0;
+    for (uint8_t i=0; i<8; i++) {           // compare with the visible frame
+        uint8_t line = (progmem ? pgm_read_byte(&charmap[i]) : charmap[i]) & 0x1F;
+        if (anim->frame[i] != line) {
+            anim->frame[i] = line;
+            changed = 1;
+        }
+    }
+    if (!changed) {
+        return;     // nothing to do
+    }
+
+    uint8_t back = anim->location[anim->front ^ 1];
+    I2C_startWait(I2C_LCD_ADDRESS & ~I2C_WRITE);               // start I2C connection to LCD
+    I2C_LCD_command4bit(I2C_LCD_SETCGRAMADDR | (back << 3));        // send set CGram + ram address
+    for (uint8_t i=0; i<8; i++) {           // loop though the character lines
+        I2C_LCD_write(anim->frame[i]);
+    }
+    uint8_t address = 0xFF;
+    for (uint8_t i=0; i<anim->numcells; i++) {
+        if (anim->cells[i] != address) {    // neighbouring cells need no new address
+            address = anim->cells[i];
+            I2C_LCD_command4bit(I2C_LCD_SETDDRAMADDR | address);
+        }
+        I2C_LCD_write(back);                // switch cell to the new frame
+        address++;
+    }
+    I2C_stop();    // stop I2C connection to LCD
+    anim->front ^= 1;
+}
+
+void I2C_LCD_animFrame(struct I2C_LCD_anim *anim, uint8_t charmap[]) {
+    I2C_LCD_animSwap(anim, charmap, 0);
+}
+
+void I2C_LCD_animFrame_P(struct I2C_LCD_anim *anim, const uint8_t *charmap) {
+    I2C_LCD_animSwap(anim, charmap, 1);
+}
+
+void I2C_LCD_animRelease(struct I2C_LCD_anim *anim) {
+    I2C_LCD_glyphFree(anim->location[0]);
+    I2C_LCD_glyphFree(anim->location[1]);
+}
+
 /**
  * This file is part of I2C_LCD
  * 
@@ -72,6 +72,26 @@
 #define I2C_LCD_ON  0xFF
 #define I2C_LCD_OFF 0x00 
 
+// flags for number output
+#define I2C_LCD_ALIGN_RIGHT 0x00
+#define I2C_LCD_ALIGN_LEFT  0x01
+#define I2C_LCD_PAD_ZERO    0x02
+
+// glyph manager
+#define I2C_LCD_GLYPH_SLOTS 8       // number of CGRAM locations
+#define I2C_LCD_GLYPH_NONE  0xFF    // no free CGRAM location
+#define I2C_LCD_ANIM_CELLS  4       // max. cells showing one animated glyph
+
+/** @brief animated glyph with a front and a back CGRAM location */
+struct I2C_LCD_anim
+{
+    uint8_t location[2];                // CGRAM locations (front & back)
+    uint8_t front;                      // index of the visible location
+    uint8_t numcells;                   // number of cells showing the glyph
+    uint8_t cells[I2C_LCD_ANIM_CELLS];  // DDRAM addresses of these cells
+    uint8_t frame[8];                   // bitmap of the visible frame
+};
+
 /** ===================================================
  * @brief function to initialize the I2C-LCD-Modul
  * + set 4-Bit mode
@@ -135,6 +155,88 @@ void I2C_LCD_print(char str[]);
  */
 void I2C_LCD_printChar(char c);
 
+/** ===================================================
+ * @brief function to print an unsigned number
+ * to the LCD-Modul without sprintf or a string buffer
+ * 
+ * @param value number to print
+ * @param width minimum number of characters (0 = no padding)
+ * @param flags I2C_LCD_ALIGN_RIGHT / I2C_LCD_ALIGN_LEFT | I2C_LCD_PAD_ZERO
+ */
+void I2C_LCD_printUInt(uint32_t value, uint8_t width, uint8_t flags);
+
+/** ===================================================
+ * @brief function to print a signed number
+ * to the LCD-Modul without sprintf or a string buffer
+ * 
+ * @param value number to print
+ * @param width minimum number of characters incl. sign (0 = no padding)
+ * @param flags I2C_LCD_ALIGN_RIGHT / I2C_LCD_ALIGN_LEFT | I2C_LCD_PAD_ZERO
+ */
+void I2C_LCD_printInt(int32_t value, uint8_t width, uint8_t flags);
+
+/** ===================================================
+ * @brief function to print a fixed point number
+ * f.e. value 1234 with 2 decimals results in "12.34"
+ * 
+ * @param value number scaled by 10^decimals
+ * @param decimals number of digits behind the point (0 - 9)
+ * @param width minimum number of characters incl. sign and point
+ * @param flags I2C_LCD_ALIGN_RIGHT / I2C_LCD_ALIGN_LEFT | I2C_LCD_PAD_ZERO
+ */
+void I2C_LCD_printFixed(int32_t value, uint8_t decimals, uint8_t width, uint8_t flags);
+
+/** ===================================================
+ * @brief function to print a number in hexadecimal
+ * (upper case, without prefix) to the LCD-Modul
+ * 
+ * @param value number to print
+ * @param width minimum number of characters (0 = no padding)
+ * @param flags I2C_LCD_ALIGN_RIGHT / I2C_LCD_ALIGN_LEFT | I2C_LCD_PAD_ZERO
+ */
+void I2C_LCD_printHex(uint32_t value, uint8_t width, uint8_t flags);
+
+/** ===================================================
+ * @brief function to write a decimal number
+ * to the display. No I2C connections is etabilshed
+ * 
+ * @param value magnitude of the number
+ * @param negative 1 if a minus sign should be written
+ * @param decimals number of digits behind the point (0 - 9)
+ * @param width minimum number of characters
+ * @param flags I2C_LCD_ALIGN_RIGHT / I2C_LCD_ALIGN_LEFT | I2C_LCD_PAD_ZERO
+ */
+void I2C_LCD_writeNumber(uint32_t value, uint8_t negative, uint8_t decimals, uint8_t width, uint8_t flags);
+
+/** ===================================================
+ * @brief function to write a hexadecimal number
+ * to the display. No I2C connections is etabilshed
+ * 
+ * @param value number to write
+ * @param width minimum number of characters
+ * @param flags I2C_LCD_ALIGN_RIGHT / I2C_LCD_ALIGN_LEFT | I2C_LCD_PAD_ZERO
+ */
+void I2C_LCD_writeHex(uint32_t value, uint8_t width, uint8_t flags);
+
+/** ===================================================
+ * @brief function to count the decimal digits of a number
+ * 
+ * @param value number
+ * @return uint8_t number of digits (1 - 10)
+ */
+uint8_t I2C_LCD_decimalLength(uint32_t value);
+
+/** ===================================================
+ * @brief function to take the digit at a decimal place
+ * off a number by subtracting powers of ten (no division).
+ * Call it from the highest place down to place 0.
+ * 
+ * @param value number, must be smaller than 10^(place+1), holds the rest afterwards
+ * @param place decimal place 0 (units) - 9
+ * @return uint8_t digit 0 - 9
+ */
+uint8_t I2C_LCD_decimalDigit(uint32_t *value, uint8_t place);
+
 /** ===================================================
  * @brief function to dis/enable the LCD layer of the modul
  * 
@@ -205,6 +307,132 @@ void I2C_LCD_cursorFixPosition(uint8_t state);
  */
 void I2C_LCD_createChar(uint8_t location, uint8_t charmap[]);
 
+/** ===================================================
+ * @brief function to create a custom char in the CGRAM
+ * from a bitmap stored in the program memory (PROGMEM)
+ * 
+ * @param location location in the CGRAM 0x00 - 0x07
+ * @param charmap 5x8 array with dots in PROGMEM
+ */
+void I2C_LCD_createChar_P(uint8_t location, const uint8_t *charmap);
+
+/** ===================================================
+ * @brief function to create several custom chars in a row
+ * with one CGRAM address in one I2C connection
+ * 
+ * @param location first location in the CGRAM 0x00 - 0x07
+ * @param count number of chars
+ * @param charmaps count * 8 lines with dots in PROGMEM
+ */
+void I2C_LCD_createChars_P(uint8_t location, uint8_t count, const uint8_t *charmaps);
+
+/** ===================================================
+ * @brief function to get a CGRAM location for a glyph.
+ * The PROGMEM address of the bitmap is the ID of the glyph.
+ * If the glyph is already in the CGRAM no upload is done,
+ * otherwise the least recently used glyph which is
+ * not visible on the display is replaced.
+ * Locations written with I2C_LCD_createChar are never replaced.
+ * 
+ * Must not be called while an I2C connection to the LCD is open.
+ * After an upload the cursor must be set again before printing.
+ * 
+ * @param bitmap 5x8 array with dots in PROGMEM
+ * @return uint8_t location 0x00 - 0x07 or I2C_LCD_GLYPH_NONE
+ */
+uint8_t I2C_LCD_glyphRequest(const uint8_t *bitmap);
+
+/** ===================================================
+ * @brief function to reserve a CGRAM location
+ * for own use (f.e. animations). The location
+ * is not used by the glyph manager until it is freed.
+ * 
+ * @return uint8_t location 0x00 - 0x07 or I2C_LCD_GLYPH_NONE
+ */
+uint8_t I2C_LCD_glyphAlloc(void);
+
+/** ===================================================
+ * @brief function to give a reserved location
+ * or a location written with I2C_LCD_createChar
+ * back to the glyph manager
+ * 
+ * @param location location in the CGRAM 0x00 - 0x07
+ */
+void I2C_LCD_glyphFree(uint8_t location);
+
+/** ===================================================
+ * @brief function to mark a glyph as visible.
+ * Has to be called for each cell where the glyph is printed,
+ * visible glyphs are never replaced.
+ * 
+ * @param location location in the CGRAM 0x00 - 0x07
+ */
+void I2C_LCD_glyphShow(uint8_t location);
+
+/** ===================================================
+ * @brief function to mark a glyph as no longer visible.
+ * Has to be called for each cell where the glyph was overwritten.
+ * 
+ * @param location location in the CGRAM 0x00 - 0x07
+ */
+void I2C_LCD_glyphHide(uint8_t location);
+
+/** ===================================================
+ * @brief function to forget all glyphs in the glyph manager
+ * f.e. after the display was cleared or re-initialized.
+ * Reserved locations stay reserved.
+ */
+void I2C_LCD_glyphReset(void);
+
+/** ===================================================
+ * @brief function to initialize an animated glyph.
+ * Two CGRAM locations are reserved: the next frame is always
+ * written to the hidden location and the cells are switched
+ * over afterwards, so no half-updated glyph is ever visible.
+ * 
+ * @param anim animated glyph
+ * @return uint8_t success = 0
+ */
+uint8_t I2C_LCD_animInit(struct I2C_LCD_anim *anim);
+
+/** ===================================================
+ * @brief function to show the animated glyph at a position
+ * max. I2C_LCD_ANIM_CELLS positions per animated glyph.
+ * The cell stays blank until the first frame is sent.
+ * 
+ * @param anim animated glyph
+ * @param col column: >0 && <numcolumn
+ * @param row row: >0 && <numlines
+ */
+void I2C_LCD_animPlace(struct I2C_LCD_anim *anim, uint8_t col, uint8_t row);
+
+/** ===================================================
+ * @brief function to show the next frame of an animated glyph.
+ * Costs max. 8 data bytes and one byte per cell,
+ * nothing is sent if the frame did not change.
+ * 
+ * @param anim animated glyph
+ * @param charmap 5x8 array with dots
+ */
+void I2C_LCD_animFrame(struct I2C_LCD_anim *anim, uint8_t charmap[]);
+
+/** ===================================================
+ * @brief function to show the next frame of an animated glyph
+ * from a bitmap stored in the program memory (PROGMEM)
+ * 
+ * @param anim animated glyph
+ * @param charmap 5x8 array with dots in PROGMEM
+ */
+void I2C_LCD_animFrame_P(struct I2C_LCD_anim *anim, const uint8_t *charmap);
+
+/** ===================================================
+ * @brief function to give the CGRAM locations
+ * of an animated glyph back to the glyph manager
+ * 
+ * @param anim animated glyph
+ */
+void I2C_LCD_animRelease(struct I2C_LCD_anim *anim);
+
 /** ===================================================
  * @brief function to write a single character (ASCII & custom)
  * to the display. No I2C connections is etabilshed
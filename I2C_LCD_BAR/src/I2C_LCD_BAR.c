@@ -0,0 +1,134 @@
+/**
+ * @file I2C_LCD_BAR.c
+ *
+ * @author ClefaMedia
+ *
+ * @version 1.0
+ *
+ * @copyright
+ * Copyright (C) ClefaMedia 2021. 
+ * All Rights GNU GLP Licensed.
+ *
+ * @brief This library was created to display bar graphs and progress bars
+ * with 5 steps per character (f.e. 100 steps on a 20 column row).
+ * 
+ * The partial characters are requested from the glyph manager of I2C_LCD,
+ * so 4 CGRAM locations are used as long as a bar exists.
+ */
+
+
+#include "I2C_LCD_BAR.h"
+#include "I2C_LCD.h"
+#include <avr/pgmspace.h>
+#include <I2C.h>
+
+// cells filled with 1 - 4 pixel columns (5 columns = full block of the character ROM)
+static const uint8_t I2C_LCD_BAR_glyphs[4][8] PROGMEM = {
+    {0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10},
+    {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18},
+    {0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C},
+    {0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E}
+};
+
+// character of a cell for a given level
+static uint8_t I2C_LCD_BAR_cell(struct I2C_LCD_bar *bar, uint8_t cell, uint8_t level)
+{
+    uint8_t start = cell * I2C_LCD_BAR_STEPS;   // level where the cell starts to fill
+    if (level <= start)
+    {
+        return ' ';                             // empty cell
+    }
+    if (level - start >= I2C_LCD_BAR_STEPS)
+    {
+        return 0xFF;                            // full cell
+    }
+    return bar->location[level - start - 1];    // partial cell
+}
+
+// send the cells from first to last for the current level
+static void I2C_LCD_BAR_draw(struct I2C_LCD_bar *bar, uint8_t first, uint8_t last)
+{
+    I2C_startWait(I2C_LCD_ADDRESS & ~I2C_WRITE);               // start I2C connection to LCD
+    I2C_LCD_command4bit(I2C_LCD_SETDDRAMADDR | (bar->address + first));    // set cursor to first cell
+    for (uint8_t i = first; i <= last; i++)
+    {
+        I2C_LCD_write(I2C_LCD_BAR_cell(bar, i, bar->level));
+    }
+    I2C_stop();                                                // stop I2C connection
+}
+
+uint8_t I2C_LCD_BAR_init(struct I2C_LCD_bar *bar, uint8_t col, uint8_t row, uint8_t length)
+{
+    if ((length == 0) || (length > 255 / I2C_LCD_BAR_STEPS))
+    {
+        return 1;   // ERROR: no cells or the level does not fit into 8 bit
+    }
+    for (uint8_t i = 0; i < 4; i++)     // get the partial cells from the glyph manager
+    {
+        bar->location[i] = I2C_LCD_glyphRequest(I2C_LCD_BAR_glyphs[i]);
+        if (bar->location[i] == I2C_LCD_GLYPH_NONE)
+        {
+            while (i--)                 // give the already visible ones back
+            {
+                I2C_LCD_glyphHide(bar->location[i]);
+            }
+            return 1;   // ERROR
+        }
+        I2C_LCD_glyphShow(bar->location[i]);    // keep glyph while the bar exists
+    }
+
+    col = (col >= numcols) ? numcols : col;         // limit to initialized cols
+    row = (row >= numlines) ? numlines : row;       // limit to initialized lines
+    bar->address = (col-1) + row_offsets[row-1];
+    bar->length = length;
+    bar->level = 0;
+    I2C_LCD_BAR_draw(bar, 0, length - 1);           // print empty bar
+    return 0;   // SUCCESS
+}
+
+void I2C_LCD_BAR_set(struct I2C_LCD_bar *bar, uint8_t level)
+{
+    uint8_t max = bar->length * I2C_LCD_BAR_STEPS;
+    level = (level > max) ? max : level;            // limit to bar length
+    if (level == bar->level)
+    {
+        return;                                     // nothing changed
+    }
+
+    // only the cells between the old and the new level change
+    uint8_t low = (level < bar->level) ? level : bar->level;
+    uint8_t high = (level < bar->level) ? bar->level : level;
+    bar->level = level;
+    I2C_LCD_BAR_draw(bar, low / I2C_LCD_BAR_STEPS, (high - 1) / I2C_LCD_BAR_STEPS);
+}
+
+void I2C_LCD_BAR_setPercent(struct I2C_LCD_bar *bar, uint8_t percent)
+{
+    percent = (percent > 100) ? 100 : percent;      // limit to 100%
+    I2C_LCD_BAR_set(bar, ((uint16_t)percent * bar->length * I2C_LCD_BAR_STEPS + 50) / 100);
+}
+
+void I2C_LCD_BAR_release(struct I2C_LCD_bar *bar)
+{
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        I2C_LCD_glyphHide(bar->location[i]);
+    }
+}
+
+/**
+ * This file is part of I2C_LCD_BAR Library
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
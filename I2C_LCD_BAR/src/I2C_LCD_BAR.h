@@ -0,0 +1,95 @@
+/**
+ * @file I2C_LCD_BAR.h
+ *
+ * @author ClefaMedia
+ *
+ * @version 1.0
+ *
+ * @copyright
+ * Copyright (C) ClefaMedia 2021. 
+ * All Rights GNU GLP Licensed.
+ *
+ * @brief This library was created to display bar graphs and progress bars
+ * with 5 steps per character (f.e. 100 steps on a 20 column row).
+ * 
+ * The partial characters are requested from the glyph manager of I2C_LCD,
+ * so 4 CGRAM locations are used as long as a bar exists.
+ */
+
+
+#ifndef _I2C_LCD_BAR_H                  // prevents duplicate
+#define _I2C_LCD_BAR_H   1              // forward declarations
+
+
+#include "I2C_LCD.h"                    // requires LCD over I2C
+
+#define I2C_LCD_BAR_STEPS   5           // steps (pixel columns) per character
+
+/** @brief bar graph on one row of the display */
+struct I2C_LCD_bar
+{
+    uint8_t address;                    // DDRAM address of the first cell
+    uint8_t length;                     // number of cells
+    uint8_t level;                      // displayed level in steps
+    uint8_t location[4];                // CGRAM locations of the 1-4 step cells
+};
+
+/** ===================================================
+ * @brief function to initialize a bar and 
+ * print it empty to the LCD
+ * 
+ * @param bar bar graph
+ * @param col left column of the bar
+ * @param row row of the bar
+ * @param length number of cells (1 - 51)
+ * @return uint8_t success = 0, 1 if the length is not 1 - 51
+ * or no CGRAM locations are free
+ */
+uint8_t I2C_LCD_BAR_init(struct I2C_LCD_bar *bar, uint8_t col, uint8_t row, uint8_t length);
+
+/** ===================================================
+ * @brief function to set the level of a bar.
+ * Only the cells which changed are sent,
+ * a change by one step costs one character.
+ * 
+ * @param bar bar graph
+ * @param level level from 0 to length * I2C_LCD_BAR_STEPS
+ */
+void I2C_LCD_BAR_set(struct I2C_LCD_bar *bar, uint8_t level);
+
+/** ===================================================
+ * @brief function to set the level of a bar in percent
+ * 
+ * @param bar bar graph
+ * @param percent level from 0 to 100
+ */
+void I2C_LCD_BAR_setPercent(struct I2C_LCD_bar *bar, uint8_t percent);
+
+/** ===================================================
+ * @brief function to give the CGRAM locations of a bar
+ * back to the glyph manager. The bar stays on the display
+ * until it is overwritten.
+ * 
+ * @param bar bar graph
+ */
+void I2C_LCD_BAR_release(struct I2C_LCD_bar *bar);
+
+#endif                               // end prevent duplicate forward
+/* _I2C_LCD_BAR_H */                 // declarations block
+
+/**
+ * This file is part of I2C_LCD_BAR Library
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
@@ -0,0 +1,221 @@
+/**
+ * @file I2C_LCD_CANVAS.c
+ *
+ * @author ClefaMedia
+ *
+ * @version 1.0
+ *
+ * @copyright
+ * Copyright (C) ClefaMedia 2021. 
+ * All Rights GNU GLP Licensed.
+ *
+ * @brief This library was created to draw small pixel graphics on a LCD.
+ * 
+ * All 8 custom chars are arranged as a block of 4x2 characters (20x16 pixels).
+ * The bitmap is stored in the RAM, I2C_LCD_CANVAS_flush compares it with
+ * a copy of the CGRAM and only sends the lines which really changed,
+ * so redrawing the same picture (f.e. clear + sparkline) sends nothing.
+ */
+
+
+#include "I2C_LCD_CANVAS.h"
+#include "I2C_LCD.h"
+#include <I2C.h>
+
+static uint8_t canvas_location[8];      // CGRAM location of each character
+static uint8_t canvas_bitmap[8][8];     // lines of each character (4 upper, 4 lower)
+static uint8_t canvas_shown[8][8];      // lines in the CGRAM since the last flush (0xFF = unknown)
+
+// change a single pixel in the RAM
+static void I2C_LCD_CANVAS_pixel(uint8_t x, uint8_t y, uint8_t on)
+{
+    if ((x >= I2C_LCD_CANVAS_WIDTH) || (y >= I2C_LCD_CANVAS_HEIGHT))
+    {
+        return;                                     // outside of the canvas
+    }
+    uint8_t chr = ((y >> 3) << 2) + (x / 5);        // character 0-3 upper row, 4-7 lower row
+    uint8_t line = y & 0x07;
+    uint8_t mask = 0x10 >> (x % 5);                 // bit 4 is the left pixel
+    uint8_t old = canvas_bitmap[chr][line];
+    canvas_bitmap[chr][line] = on ? (old | mask) : (old & ~mask);
+}
+
+uint8_t I2C_LCD_CANVAS_init(uint8_t col, uint8_t row)
+{
+    for (uint8_t i = 0; i < 8; i++)     // reserve all CGRAM locations
+    {
+        canvas_location[i] = I2C_LCD_glyphAlloc();
+        if (canvas_location[i] == I2C_LCD_GLYPH_NONE)
+        {
+            while (i--)
+            {
+                I2C_LCD_glyphFree(canvas_location[i]);
+            }
+            return 1;   // ERROR
+        }
+        for (uint8_t line = 0; line < 8; line++)
+        {
+            canvas_bitmap[i][line] = 0;
+            canvas_shown[i][line] = 0xFF;   // CGRAM content is unknown
+        }
+    }
+
+    I2C_startWait(I2C_LCD_ADDRESS & ~I2C_WRITE);   // start I2C connection to LCD
+    for (uint8_t i = 0; i < 2; i++)                     // print the 4x2 characters
+    {
+        I2C_LCD_setCursorWOI2C(col, row + i);
+        for (uint8_t j = 0; j < 4; j++)
+        {
+            I2C_LCD_write(canvas_location[(i << 2) + j]);
+        }
+    }
+    I2C_stop();                                    // stop I2C connection
+
+    I2C_LCD_CANVAS_flush();
+    return 0;   // SUCCESS
+}
+
+void I2C_LCD_CANVAS_clear(void)
+{
+    for (uint8_t i = 0; i < 8; i++)
+    {
+        for (uint8_t line = 0; line < 8; line++)
+        {
+            canvas_bitmap[i][line] = 0;     // flush compares with the CGRAM
+        }
+    }
+}
+
+void I2C_LCD_CANVAS_setPixel(uint8_t x, uint8_t y)
+{
+    I2C_LCD_CANVAS_pixel(x, y, 1);
+}
+
+void I2C_LCD_CANVAS_clearPixel(uint8_t x, uint8_t y)
+{
+    I2C_LCD_CANVAS_pixel(x, y, 0);
+}
+
+void I2C_LCD_CANVAS_line(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1)
+{
+    // Bresenham line algorithm
+    int8_t dx = (x1 > x0) ? (x1 - x0) : (x0 - x1);
+    int8_t dy = (y1 > y0) ? (y0 - y1) : (y1 - y0);
+    int8_t sx = (x0 < x1) ? 1 : -1;
+    int8_t sy = (y0 < y1) ? 1 : -1;
+    int8_t err = dx + dy;
+
+    while (1)
+    {
+        I2C_LCD_CANVAS_pixel(x0, y0, 1);
+        if ((x0 == x1) && (y0 == y1))
+        {
+            break;
+        }
+        int8_t e2 = 2 * err;
+        if (e2 >= dy)
+        {
+            err += dy;
+            x0 += sx;
+        }
+        if (e2 <= dx)
+        {
+            err += dx;
+            y0 += sy;
+        }
+    }
+}
+
+void I2C_LCD_CANVAS_vbar(uint8_t x, uint8_t height)
+{
+    for (uint8_t y = 0; y < I2C_LCD_CANVAS_HEIGHT; y++)
+    {
+        I2C_LCD_CANVAS_pixel(x, y, (y >= I2C_LCD_CANVAS_HEIGHT - height));
+    }
+}
+
+void I2C_LCD_CANVAS_sparkline(const uint8_t *values, uint8_t count, uint8_t min, uint8_t max)
+{
+    uint8_t range = (max > min) ? (max - min) : 1;
+    uint8_t lastY = 0;
+
+    if (count > I2C_LCD_CANVAS_WIDTH)   // only the newest values fit
+    {
+        values += count - I2C_LCD_CANVAS_WIDTH;
+        count = I2C_LCD_CANVAS_WIDTH;
+    }
+
+    I2C_LCD_CANVAS_clear();
+    for (uint8_t x = 0; x < count; x++)
+    {
+        uint8_t value = values[x];
+        value = (value < min) ? min : ((value > max) ? max : value);    // limit to min - max
+        uint8_t y = (I2C_LCD_CANVAS_HEIGHT - 1) - ((uint16_t)(value - min) * (I2C_LCD_CANVAS_HEIGHT - 1) + range / 2) / range;
+        if (x)
+        {
+            I2C_LCD_CANVAS_line(x - 1, lastY, x, y);    // connect with the last value
+        }
+        else
+        {
+            I2C_LCD_CANVAS_pixel(x, y, 1);
+        }
+        lastY = y;
+    }
+}
+
+void I2C_LCD_CANVAS_flush(void)
+{
+    uint8_t started = 0;
+    for (uint8_t i = 0; i < 8; i++)
+    {
+        uint8_t next = 0xFF;                // line the CGRAM address points to
+        for (uint8_t line = 0; line < 8; line++)
+        {
+            if (canvas_bitmap[i][line] == canvas_shown[i][line])
+            {
+                continue;                   // line is already in the CGRAM
+            }
+            if (!started)                   // open connection only if something changed
+            {
+                I2C_startWait(I2C_LCD_ADDRESS & ~I2C_WRITE);
+                started = 1;
+            }
+            if (line != next)               // following lines need no new address
+            {
+                I2C_LCD_command4bit(I2C_LCD_SETCGRAMADDR | (canvas_location[i] << 3) | line);
+            }
+            I2C_LCD_write(canvas_bitmap[i][line]);
+            canvas_shown[i][line] = canvas_bitmap[i][line];
+            next = line + 1;
+        }
+    }
+    if (started)
+    {
+        I2C_stop();                         // stop I2C connection
+    }
+}
+
+void I2C_LCD_CANVAS_release(void)
+{
+    for (uint8_t i = 0; i < 8; i++)
+    {
+        I2C_LCD_glyphFree(canvas_location[i]);
+    }
+}
+
+/**
+ * This file is part of I2C_LCD_CANVAS Library
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
@@ -0,0 +1,125 @@
+/**
+ * @file I2C_LCD_CANVAS.h
+ *
+ * @author ClefaMedia
+ *
+ * @version 1.0
+ *
+ * @copyright
+ * Copyright (C) ClefaMedia 2021. 
+ * All Rights GNU GLP Licensed.
+ *
+ * @brief This library was created to draw small pixel graphics on a LCD.
+ * 
+ * All 8 custom chars are arranged as a block of 4x2 characters (20x16 pixels).
+ * The bitmap is stored in the RAM, I2C_LCD_CANVAS_flush compares it with
+ * a copy of the CGRAM and only sends the lines which really changed,
+ * so redrawing the same picture (f.e. clear + sparkline) sends nothing.
+ */
+
+
+#ifndef _I2C_LCD_CANVAS_H               // prevents duplicate
+#define _I2C_LCD_CANVAS_H   1           // forward declarations
+
+
+#include "I2C_LCD.h"                    // requires LCD over I2C
+
+#define I2C_LCD_CANVAS_WIDTH    20      // pixel columns (4 characters)
+#define I2C_LCD_CANVAS_HEIGHT   16      // pixel rows (2 characters)
+
+/** ===================================================
+ * @brief function to initialize the canvas.
+ * All 8 CGRAM locations are reserved in the glyph manager
+ * and the 4x2 characters are printed at the given position.
+ * 
+ * @param col left column of the canvas
+ * @param row upper row of the canvas
+ * @return uint8_t success = 0
+ */
+uint8_t I2C_LCD_CANVAS_init(uint8_t col, uint8_t row);
+
+/** ===================================================
+ * @brief function to clear all pixels
+ */
+void I2C_LCD_CANVAS_clear(void);
+
+/** ===================================================
+ * @brief function to set a pixel
+ * Upper left pixel is 0, 0
+ * 
+ * @param x column: 0 - 19
+ * @param y row: 0 - 15
+ */
+void I2C_LCD_CANVAS_setPixel(uint8_t x, uint8_t y);
+
+/** ===================================================
+ * @brief function to clear a pixel
+ * Upper left pixel is 0, 0
+ * 
+ * @param x column: 0 - 19
+ * @param y row: 0 - 15
+ */
+void I2C_LCD_CANVAS_clearPixel(uint8_t x, uint8_t y);
+
+/** ===================================================
+ * @brief function to draw a line between two pixels
+ * 
+ * @param x0 column of the start pixel
+ * @param y0 row of the start pixel
+ * @param x1 column of the end pixel
+ * @param y1 row of the end pixel
+ */
+void I2C_LCD_CANVAS_line(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1);
+
+/** ===================================================
+ * @brief function to draw a vertical bar from the bottom,
+ * the rest of the column is cleared
+ * 
+ * @param x column: 0 - 19
+ * @param height height in pixels: 0 - 16
+ */
+void I2C_LCD_CANVAS_vbar(uint8_t x, uint8_t height);
+
+/** ===================================================
+ * @brief function to clear the canvas and draw a sparkline,
+ * the values are scaled from min - max to the full height.
+ * Only the last 20 values are drawn.
+ * 
+ * @param values array with values
+ * @param count number of values
+ * @param min value at the bottom line
+ * @param max value at the top line
+ */
+void I2C_LCD_CANVAS_sparkline(const uint8_t *values, uint8_t count, uint8_t min, uint8_t max);
+
+/** ===================================================
+ * @brief function to send all changed lines to the CGRAM
+ * The cursor must be set again before printing.
+ */
+void I2C_LCD_CANVAS_flush(void);
+
+/** ===================================================
+ * @brief function to give the CGRAM locations 
+ * back to the glyph manager
+ */
+void I2C_LCD_CANVAS_release(void);
+
+#endif                               // end prevent duplicate forward
+/* _I2C_LCD_CANVAS_H */              // declarations block
+
+/**
+ * This file is part of I2C_LCD_CANVAS Library
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
@@ -13,403 +13,867 @@
  * 
  * The I2C library from clefa is used for the I2C-connection.
  * The I2C-LCD initialization for a 4x20 LCD is already integrated in this Library.
+ * Other display sizes (f.e. 2x16) are supported with the fonts 3x3 and 3x2.
  */
 
 
 #include "I2C_LCD_DN.h"
 #include "I2C_LCD.h"
 #include <util/delay.h>
+#include <avr/pgmspace.h>
 #include <I2C.h>
 
-void I2C_LCD_DN_init()
+// custom chars of the font 4x4 in the order of the CGRAM addresses
+static const uint8_t I2C_LCD_DN_chars4x4[8 * 8] PROGMEM = {
+    0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,     // UPPER_BAR
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F,     // LOWER_BAR
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,     // LEFT_BAR
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,     // RIGHT_BAR
+    0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00,     // LEFT_DOT
+    0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00,     // RIGHT_DOT
+    0x18, 0x18, 0x0C, 0x0C, 0x06, 0x06, 0x03, 0x03,     // B_SLASH
+    0x03, 0x03, 0x06, 0x06, 0x0C, 0x0C, 0x18, 0x18      // F_SLASH
+};
+
+// fields of the glyphs (numbers 0-9, Yen, blank, minus, degree, letters), row by row from the top
+static const uint8_t I2C_LCD_DN_glyphs4x4[I2C_LCD_DN_GLYPHS][4 * 4] PROGMEM = {
+    {   // 0
+        FULL_BAR,   UPPER_BAR,  UPPER_BAR,  FULL_BAR,
+        FULL_BAR,   ' ',        ' ',        FULL_BAR,
+        FULL_BAR,   ' ',        ' ',        FULL_BAR,
+        FULL_BAR,   LOWER_BAR,  LOWER_BAR,  FULL_BAR
+    },
+    {   // 1
+        ' ',        ' ',        ' ',        FULL_BAR,
+        ' ',        ' ',        ' ',        FULL_BAR,
+        ' ',        ' ',        ' ',        FULL_BAR,
+        ' ',        ' ',        ' ',        FULL_BAR
+    },
+    {   // 2
+        UPPER_BAR,  UPPER_BAR,  UPPER_BAR,  FULL_BAR,
+        LOWER_BAR,  LOWER_BAR,  LOWER_BAR,  FULL_BAR,
+        FULL_BAR,   UPPER_BAR,  UPPER_BAR,  UPPER_BAR,
+        FULL_BAR,   LOWER_BAR,  LOWER_BAR,  LOWER_BAR
+    },
+    {   // 3
+        UPPER_BAR,  UPPER_BAR,  UPPER_BAR,  FULL_BAR,
+        LOWER_BAR,  LOWER_BAR,  LOWER_BAR,  FULL_BAR,
+        UPPER_BAR,  UPPER_BAR,  UPPER_BAR,  FULL_BAR,
+        LOWER_BAR,  LOWER_BAR,  LOWER_BAR,  FULL_BAR
+    },
+    {   // 4
+        FULL_BAR,   ' ',        ' ',        ' ',
+        FULL_BAR,   ' ',        FULL_BAR,   ' ',
+        UPPER_BAR,  UPPER_BAR,  FULL_BAR,   UPPER_BAR,
+        ' ',        ' ',        FULL_BAR,   ' '
+    },
+    {   // 5
+        FULL_BAR,   UPPER_BAR,  UPPER_BAR,  UPPER_BAR,
+        FULL_BAR,   LOWER_BAR,  LOWER_BAR,  LOWER_BAR,
+        UPPER_BAR,  UPPER_BAR,  UPPER_BAR,  FULL_BAR,
+        LOWER_BAR,  LOWER_BAR,  LOWER_BAR,  FULL_BAR
+    },
+    {   // 6
+        FULL_BAR,   UPPER_BAR,  UPPER_BAR,  UPPER_BAR,
+        FULL_BAR,   LOWER_BAR,  LOWER_BAR,  LOWER_BAR,
+        FULL_BAR,   UPPER_BAR,  UPPER_BAR,  FULL_BAR,
+        FULL_BAR,   LOWER_BAR,  LOWER_BAR,  FULL_BAR
+    },
+    {   // 7
+        UPPER_BAR,  UPPER_BAR,  UPPER_BAR,  FULL_BAR,
+        ' ',        ' ',        ' ',        FULL_BAR,
+        ' ',        ' ',        ' ',        FULL_BAR,
+        ' ',        ' ',        ' ',        FULL_BAR
+    },
+    {   // 8
+        FULL_BAR,   UPPER_BAR,  UPPER_BAR,  FULL_BAR,
+        FULL_BAR,   LOWER_BAR,  LOWER_BAR,  FULL_BAR,
+        FULL_BAR,   UPPER_BAR,  UPPER_BAR,  FULL_BAR,
+        FULL_BAR,   LOWER_BAR,  LOWER_BAR,  FULL_BAR
+    },
+    {   // 9
+        FULL_BAR,   UPPER_BAR,  UPPER_BAR,  FULL_BAR,
+        FULL_BAR,   LOWER_BAR,  LOWER_BAR,  FULL_BAR,
+        UPPER_BAR,  UPPER_BAR,  UPPER_BAR,  FULL_BAR,
+        LOWER_BAR,  LOWER_BAR,  LOWER_BAR,  FULL_BAR
+    },
+    {   // Yen
+        B_SLASH,    ' ',        ' ',        F_SLASH,
+        ' ',        B_SLASH,    F_SLASH,    ' ',
+        UPPER_BAR,  RIGHT_BAR,  LEFT_BAR,   UPPER_BAR,
+        UPPER_BAR,  RIGHT_BAR,  LEFT_BAR,   UPPER_BAR
+    },
+    {   // blank
+        ' ',        ' ',        ' ',        ' ',
+        ' ',        ' ',        ' ',        ' ',
+        ' ',        ' ',        ' ',        ' ',
+        ' ',        ' ',        ' ',        ' '
+    },
+    {   // minus
+        ' ',        ' ',        ' ',        ' ',
+        LOWER_BAR,  LOWER_BAR,  LOWER_BAR,  LOWER_BAR,
+        UPPER_BAR,  UPPER_BAR,  UPPER_BAR,  UPPER_BAR,
+        ' ',        ' ',        ' ',        ' '
+    },
+    {   // degree
+        FULL_BAR,   UPPER_BAR,  FULL_BAR,   ' ',
+        UPPER_BAR,  UPPER_BAR,  UPPER_BAR,  ' ',
+        ' ',        ' ',        ' ',        ' ',
+        ' ',        ' ',        ' ',        ' '
+    },
+    {   // C
+        FULL_BAR,   UPPER_BAR,  UPPER_BAR,  UPPER_BAR,
+        FULL_BAR,   ' ',        ' ',        ' ',
+        FULL_BAR,   ' ',        ' ',        ' ',
+        FULL_BAR,   LOWER_BAR,  LOWER_BAR,  LOWER_BAR
+    },
+    {   // F
+        FULL_BAR,   UPPER_BAR,  UPPER_BAR,  UPPER_BAR,
+        FULL_BAR,   LOWER_BAR,  LOWER_BAR,  ' ',
+        FULL_BAR,   UPPER_BAR,  UPPER_BAR,  ' ',
+        FULL_BAR,   ' ',        ' ',        ' '
+    },
+    {   // E
+        FULL_BAR,   UPPER_BAR,  UPPER_BAR,  UPPER_BAR,
+        FULL_BAR,   LOWER_BAR,  LOWER_BAR,  ' ',
+        FULL_BAR,   UPPER_BAR,  UPPER_BAR,  ' ',
+        FULL_BAR,   LOWER_BAR,  LOWER_BAR,  LOWER_BAR
+    },
+    {   // H
+        FULL_BAR,   ' ',        ' ',        FULL_BAR,
+        FULL_BAR,   LOWER_BAR,  LOWER_BAR,  FULL_BAR,
+        FULL_BAR,   UPPER_BAR,  UPPER_BAR,  FULL_BAR,
+        FULL_BAR,   ' ',        ' ',        FULL_BAR
+    },
+    {   // L
+        FULL_BAR,   ' ',        ' ',        ' ',
+        FULL_BAR,   ' ',        ' ',        ' ',
+        FULL_BAR,   ' ',        ' ',        ' ',
+        FULL_BAR,   LOWER_BAR,  LOWER_BAR,  LOWER_BAR
+    },
+    {   // P
+        FULL_BAR,   UPPER_BAR,  UPPER_BAR,  FULL_BAR,
+        FULL_BAR,   LOWER_BAR,  LOWER_BAR,  FULL_BAR,
+        FULL_BAR,   UPPER_BAR,  UPPER_BAR,  UPPER_BAR,
+        FULL_BAR,   ' ',        ' ',        ' '
+    }
+};
+
+// colon of the font 4x4
+static const uint8_t I2C_LCD_DN_colon4x4[2 * 4] PROGMEM = {
+    ' ',        ' ',
+    RIGHT_DOT,  LEFT_DOT,
+    RIGHT_DOT,  LEFT_DOT,
+    ' ',        ' '
+};
+
+const struct I2C_LCD_DN_font I2C_LCD_DN_font4x4 = {
+    4, 4, 8, I2C_LCD_DN_chars4x4, I2C_LCD_DN_glyphs4x4[0], I2C_LCD_DN_colon4x4
+};
+
+// CGRAM addresses of the custom characters (font 3x3)
+#define DN3_TOP     0       // upper bar
+#define DN3_BOT     1       // lower bar
+#define DN3_MID     2       // middle bar
+#define DN3_UPH     3       // upper half with middle bar
+#define DN3_LOH     4       // lower half with middle bar
+#define DN3_COLR    5       // two dots right
+#define DN3_COLL    6       // two dots left
+
+static const uint8_t I2C_LCD_DN_chars3x3[7 * 8] PROGMEM = {
+    0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,     // DN3_TOP
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F,     // DN3_BOT
+    0x00, 0x00, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0x00,     // DN3_MID
+    0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00,     // DN3_UPH
+    0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,     // DN3_LOH
+    0x00, 0x03, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00,     // DN3_COLR
+    0x00, 0x18, 0x18, 0x00, 0x00, 0x18, 0x18, 0x00      // DN3_COLL
+};
+
+static const uint8_t I2C_LCD_DN_glyphs3x3[I2C_LCD_DN_GLYPHS][3 * 3] PROGMEM = {
+    {   // 0
+        FULL_BAR,   DN3_TOP,    FULL_BAR,
+        FULL_BAR,   ' ',        FULL_BAR,
+        FULL_BAR,   DN3_BOT,    FULL_BAR
+    },
+    {   // 1
+        DN3_TOP,    FULL_BAR,   ' ',
+        ' ',        FULL_BAR,   ' ',
+        DN3_BOT,    FULL_BAR,   DN3_BOT
+    },
+    {   // 2
+        DN3_TOP,    DN3_TOP,    FULL_BAR,
+        DN3_LOH,    DN3_MID,    DN3_UPH,
+        FULL_BAR,   DN3_BOT,    DN3_BOT
+    },
+    {   // 3
+        DN3_TOP,    DN3_TOP,    FULL_BAR,
+        DN3_MID,    DN3_MID,    FULL_BAR,
+        DN3_BOT,    DN3_BOT,    FULL_BAR
+    },
+    {   // 4
+        FULL_BAR,   ' ',        FULL_BAR,
+        DN3_UPH,    DN3_MID,    FULL_BAR,
+        ' ',        ' ',        FULL_BAR
+    },
+    {   // 5
+        FULL_BAR,   DN3_TOP,    DN3_TOP,
+        DN3_UPH,    DN3_MID,    DN3_LOH,
+        DN3_BOT,    DN3_BOT,    FULL_BAR
+    },
+    {   // 6
+        FULL_BAR,   DN3_TOP,    DN3_TOP,
+        FULL_BAR,   DN3_MID,    DN3_LOH,
+        FULL_BAR,   DN3_BOT,    FULL_BAR
+    },
+    {   // 7
+        DN3_TOP,    DN3_TOP,    FULL_BAR,
+        ' ',        ' ',        FULL_BAR,
+        ' ',        ' ',        FULL_BAR
+    },
+    {   // 8
+        FULL_BAR,   DN3_TOP,    FULL_BAR,
+        FULL_BAR,   DN3_MID,    FULL_BAR,
+        FULL_BAR,   DN3_BOT,    FULL_BAR
+    },
+    {   // 9
+        FULL_BAR,   DN3_TOP,    FULL_BAR,
+        DN3_UPH,    DN3_MID,    FULL_BAR,
+        DN3_BOT,    DN3_BOT,    FULL_BAR
+    },
+    {   // invalid
+        DN3_TOP,    DN3_TOP,    DN3_TOP,
+        DN3_MID,    DN3_MID,    DN3_MID,
+        DN3_BOT,    DN3_BOT,    DN3_BOT
+    },
+    {   // blank
+        ' ',        ' ',        ' ',
+        ' ',        ' ',        ' ',
+        ' ',        ' ',        ' '
+    },
+    {   // minus
+        ' ',        ' ',        ' ',
+        DN3_MID,    DN3_MID,    DN3_MID,
+        ' ',        ' ',        ' '
+    },
+    {   // degree
+        DN3_UPH,    DN3_UPH,    ' ',
+        ' ',        ' ',        ' ',
+        ' ',        ' ',        ' '
+    },
+    {   // C
+        FULL_BAR,   DN3_TOP,    DN3_TOP,
+        FULL_BAR,   ' ',        ' ',
+        FULL_BAR,   DN3_BOT,    DN3_BOT
+    },
+    {   // F
+        FULL_BAR,   DN3_TOP,    DN3_TOP,
+        FULL_BAR,   DN3_MID,    ' ',
+        FULL_BAR,   ' ',        ' '
+    },
+    {   // E
+        FULL_BAR,   DN3_TOP,    DN3_TOP,
+        FULL_BAR,   DN3_MID,    ' ',
+        FULL_BAR,   DN3_BOT,    DN3_BOT
+    },
+    {   // H
+        FULL_BAR,   ' ',        FULL_BAR,
+        FULL_BAR,   DN3_MID,    FULL_BAR,
+        FULL_BAR,   ' ',        FULL_BAR
+    },
+    {   // L
+        FULL_BAR,   ' ',        ' ',
+        FULL_BAR,   ' ',        ' ',
+        FULL_BAR,   DN3_BOT,    DN3_BOT
+    },
+    {   // P
+        FULL_BAR,   DN3_TOP,    FULL_BAR,
+        FULL_BAR,   DN3_MID,    DN3_UPH,
+        FULL_BAR,   ' ',        ' '
+    }
+};
+
+static const uint8_t I2C_LCD_DN_colon3x3[2 * 3] PROGMEM = {
+    ' ',        ' ',
+    DN3_COLR,   DN3_COLL,
+    ' ',        ' '
+};
+
+const struct I2C_LCD_DN_font I2C_LCD_DN_font3x3 = {
+    3, 3, 7, I2C_LCD_DN_chars3x3, I2C_LCD_DN_glyphs3x3[0], I2C_LCD_DN_colon3x3
+};
+
+// CGRAM addresses of the custom characters (font 3x2)
+#define DN2_TOP     0       // upper bar
+#define DN2_BOT     1       // lower bar
+#define DN2_TB      2       // upper and lower bar
+#define DN2_UDR     3       // upper dot right
+#define DN2_UDL     4       // upper dot left
+#define DN2_LDR     5       // lower dot right
+#define DN2_LDL     6       // lower dot left
+
+static const uint8_t I2C_LCD_DN_chars3x2[7 * 8] PROGMEM = {
+    0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,     // DN2_TOP
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F,     // DN2_BOT
+    0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F,     // DN2_TB
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x00,     // DN2_UDR
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x00,     // DN2_UDL
+    0x00, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,     // DN2_LDR
+    0x00, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00      // DN2_LDL
+};
+
+static const uint8_t I2C_LCD_DN_glyphs3x2[I2C_LCD_DN_GLYPHS][3 * 2] PROGMEM = {
+    {   // 0
+        FULL_BAR,   DN2_TOP,    FULL_BAR,
+        FULL_BAR,   DN2_BOT,    FULL_BAR
+    },
+    {   // 1
+        DN2_TOP,    FULL_BAR,   ' ',
+        DN2_BOT,    FULL_BAR,   DN2_BOT
+    },
+    {   // 2
+        DN2_TB,     DN2_TB,     FULL_BAR,
+        FULL_BAR,   DN2_BOT,    DN2_BOT
+    },
+    {   // 3
+        DN2_TB,     DN2_TB,     FULL_BAR,
+        DN2_BOT,    DN2_BOT,    FULL_BAR
+    },
+    {   // 4
+        FULL_BAR,   DN2_BOT,    FULL_BAR,
+        ' ',        ' ',        FULL_BAR
+    },
+    {   // 5
+        FULL_BAR,   DN2_TB,     DN2_TB,
+        DN2_BOT,    DN2_BOT,    FULL_BAR
+    },
+    {   // 6
+        FULL_BAR,   DN2_TB,     DN2_TB,
+        FULL_BAR,   DN2_BOT,    FULL_BAR
+    },
+    {   // 7
+        DN2_TOP,    DN2_TOP,    FULL_BAR,
+        ' ',        ' ',        FULL_BAR
+    },
+    {   // 8
+        FULL_BAR,   DN2_TB,     FULL_BAR,
+        FULL_BAR,   DN2_BOT,    FULL_BAR
+    },
+    {   // 9
+        FULL_BAR,   DN2_TB,     FULL_BAR,
+        DN2_BOT,    DN2_BOT,    FULL_BAR
+    },
+    {   // invalid
+        DN2_TB,     DN2_TB,     DN2_TB,
+        DN2_BOT,    DN2_BOT,    DN2_BOT
+    },
+    {   // blank
+        ' ',        ' ',        ' ',
+        ' ',        ' ',        ' '
+    },
+    {   // minus
+        DN2_BOT,    DN2_BOT,    DN2_BOT,
+        ' ',        ' ',        ' '
+    },
+    {   // degree
+        FULL_BAR,   DN2_TB,     FULL_BAR,
+        ' ',        ' ',        ' '
+    },
+    {   // C
+        FULL_BAR,   DN2_TOP,    DN2_TOP,
+        FULL_BAR,   DN2_BOT,    DN2_BOT
+    },
+    {   // F
+        FULL_BAR,   DN2_TB,     DN2_TOP,
+        FULL_BAR,   ' ',        ' '
+    },
+    {   // E
+        FULL_BAR,   DN2_TB,     DN2_TB,
+        FULL_BAR,   DN2_BOT,    DN2_BOT
+    },
+    {   // H
+        FULL_BAR,   DN2_BOT,    FULL_BAR,
+        FULL_BAR,   ' ',        FULL_BAR
+    },
+    {   // L
+        FULL_BAR,   ' ',        ' ',
+        FULL_BAR,   DN2_BOT,    DN2_BOT
+    },
+    {   // P
+        FULL_BAR,   DN2_TB,     FULL_BAR,
+        FULL_BAR,   ' ',        ' '
+    }
+};
+
+static const uint8_t I2C_LCD_DN_colon3x2[2 * 2] PROGMEM = {
+    DN2_UDR,    DN2_UDL,
+    DN2_LDR,    DN2_LDL
+};
+
+const struct I2C_LCD_DN_font I2C_LCD_DN_font3x2 = {
+    3, 2, 7, I2C_LCD_DN_chars3x2, I2C_LCD_DN_glyphs3x2[0], I2C_LCD_DN_colon3x2
+};
+
+static const struct I2C_LCD_DN_font *dn_font = &I2C_LCD_DN_font4x4;    // current font
+static uint8_t dn_timeCols[4] = {1, 6, 12, 17};     // left columns of the numbers shown by showTime
+static uint8_t dn_colonCol = COLON_COL;             // left column of the colon
+
+// glyphs currently shown at each position (clock or number layout)
+static uint8_t dn_shown[I2C_LCD_DN_POSITIONS];
+static uint8_t dn_layout;                           // layout of the shown glyphs
+static uint8_t dn_pointCol;                         // column of the decimal point (0 = none)
+static uint8_t dn_numChars;                         // CGRAM locations pinned by the current font
+
+#define DN_LAYOUT_CLOCK     0
+#define DN_LAYOUT_NUMBER    1
+
+// rolling numbers of showTime: entry = source row of the field row, bit 7 set = row of the new glyph
+// frame f of a number with h rows shows old rows f..h-1 followed by new rows 0..f-1
+static const uint8_t dn_rollTable[3][5][4] PROGMEM = {
+    {   // height 2
+        {0x00, 0x01, 0x00, 0x00},      // frame 0
+        {0x01, 0x80, 0x00, 0x00},      // frame 1
+        {0x80, 0x81, 0x00, 0x00},      // frame 2
+        {0x00, 0x00, 0x00, 0x00},      // unused
+        {0x00, 0x00, 0x00, 0x00}       // unused
+    },
+    {   // height 3
+        {0x00, 0x01, 0x02, 0x00},      // frame 0
+        {0x01, 0x02, 0x80, 0x00},      // frame 1
+        {0x02, 0x80, 0x81, 0x00},      // frame 2
+        {0x80, 0x81, 0x82, 0x00},      // frame 3
+        {0x00, 0x00, 0x00, 0x00}       // unused
+    },
+    {   // height 4
+        {0x00, 0x01, 0x02, 0x03},      // frame 0
+        {0x01, 0x02, 0x03, 0x80},      // frame 1
+        {0x02, 0x03, 0x80, 0x81},      // frame 2
+        {0x03, 0x80, 0x81, 0x82},      // frame 3
+        {0x80, 0x81, 0x82, 0x83}       // frame 4
+    }
+};
+
+#define DN_ROLL_NEW     0x80
+#define DN_ROLL_IDLE    0xFF
+
+static uint8_t dn_rollOld[4];                       // glyph rolling out at each time position
+static uint8_t dn_rollNew[4];                       // glyph rolling in at each time position
+static uint8_t dn_rollFrame[4] = {DN_ROLL_IDLE, DN_ROLL_IDLE, DN_ROLL_IDLE, DN_ROLL_IDLE};
+
+// send the fields of a glyph which differ from the old glyph (connection must be open)
+static void I2C_LCD_DN_render(uint8_t glyph, uint8_t old, uint8_t col)
 {
-    I2C_LCD_init(20, 4);        // initialize display with 4 lines and 20 cols
-    I2C_LCD_DN_customChars();   // initialize custom chars in the CGRAM
-    I2C_LCD_DN_clearColon();    // clears the colon from the screen 
+    uint8_t size = dn_font->width * dn_font->height;
+    const uint8_t *fields = dn_font->glyphs + glyph * size;
+    const uint8_t *oldFields = dn_font->glyphs + ((old == I2C_LCD_DN_NONE) ? glyph : old) * size;
+
+    for (uint8_t row = 1; row <= dn_font->height; row++)
+    {
+        uint8_t next = 0;                                   // column the cursor points to
+        for (uint8_t i = 0; i < dn_font->width; i++)
+        {
+            uint8_t field = pgm_read_byte(fields++);
+            uint8_t oldField = pgm_read_byte(oldFields++);
+            if ((old != I2C_LCD_DN_NONE) && (field == oldField))
+            {
+                continue;                                   // field is already on the display
+            }
+            if (next != col + i)
+            {
+                I2C_LCD_setCursorWOI2C(col + i, row);       // address only after skipped fields
+            }
+            I2C_LCD_write(field);
+            next = col + i + 1;
+        }
+    }
 }
 
-void I2C_LCD_DN_customChars()
+// field of a rolling number at a frame, row 0 - height-1 and field 0 - width-1
+static uint8_t I2C_LCD_DN_rollField(uint8_t pos, uint8_t frame, uint8_t row, uint8_t i)
 {
-    // create array containing custom char build information
-    uint8_t upperBar[] = {0x1f, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00};
-    uint8_t lowerBar[] = {0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F};
-    uint8_t leftBar[] = {0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18};
-    uint8_t rightBar[] = {0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03};
-    uint8_t bSlash[] = {0x18, 0x18, 0x0C, 0x0C, 0x06, 0x06, 0x03, 0x03};
-    uint8_t fSlash[] = {0x03, 0x03, 0x06, 0x06, 0x0C, 0x0C, 0x18, 0x18};
-    uint8_t dotRight[] = {0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00};
-    uint8_t dotLeft[] = {0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00};
-
-    // push custom chars in CGRAM
-    I2C_LCD_createChar(UPPER_BAR, upperBar);
-    I2C_LCD_createChar(LOWER_BAR, lowerBar);
-    I2C_LCD_createChar(LEFT_DOT, dotLeft);
-    I2C_LCD_createChar(RIGHT_DOT, dotRight);
-    I2C_LCD_createChar(LEFT_BAR, leftBar);
-    I2C_LCD_createChar(RIGHT_BAR, rightBar);
-    I2C_LCD_createChar(B_SLASH, bSlash);
-    I2C_LCD_createChar(F_SLASH, fSlash);
+    uint8_t entry = pgm_read_byte(&dn_rollTable[dn_font->height - 2][frame][row]);
+    uint8_t glyph = (entry & DN_ROLL_NEW) ? dn_rollNew[pos] : dn_rollOld[pos];
+    uint8_t srcRow = entry & ~DN_ROLL_NEW;
+
+    return pgm_read_byte(dn_font->glyphs + (glyph * dn_font->height + srcRow) * dn_font->width + i);
 }
 
-void I2C_LCD_DN_write(uint8_t num, uint8_t col)
+// send the fields of a rolling number which differ between two frames (connection must be open)
+static void I2C_LCD_DN_rollRender(uint8_t pos, uint8_t from, uint8_t to)
+{
+    uint8_t col = dn_timeCols[pos];
+
+    for (uint8_t row = 0; row < dn_font->height; row++)
+    {
+        uint8_t next = 0;                                   // column the cursor points to
+        for (uint8_t i = 0; i < dn_font->width; i++)
+        {
+            uint8_t field = I2C_LCD_DN_rollField(pos, to, row, i);
+            if (field == I2C_LCD_DN_rollField(pos, from, row, i))
+            {
+                continue;                                   // field is already on the display
+            }
+            if (next != col + i)
+            {
+                I2C_LCD_setCursorWOI2C(col + i, row + 1);   // address only after skipped fields
+            }
+            I2C_LCD_write(field);
+            next = col + i + 1;
+        }
+    }
+}
+
+// use the position cache for a layout, a different layout draws everything again
+static void I2C_LCD_DN_layout(uint8_t layout)
 {
-    switch (num)    // print selected number at given column position to the display
+    if (dn_layout != layout)
+    {
+        I2C_LCD_DN_invalidate();
+        dn_layout = layout;
+    }
+}
+
+// send a glyph at a position if it is not already shown there (connection is opened on demand)
+static void I2C_LCD_DN_place(uint8_t pos, uint8_t glyph, uint8_t col, uint8_t *started)
+{
+    if (glyph == dn_shown[pos])
+    {
+        return;                                         // glyph did not change
+    }
+    if (!*started)
     {
-    case 0: I2C_LCD_DN_write0(col); break;
-    case 1: I2C_LCD_DN_write1(col); break;
-    case 2: I2C_LCD_DN_write2(col); break;
-    case 3: I2C_LCD_DN_write3(col); break;
-    case 4: I2C_LCD_DN_write4(col); break;
-    case 5: I2C_LCD_DN_write5(col); break;
-    case 6: I2C_LCD_DN_write6(col); break;
-    case 7: I2C_LCD_DN_write7(col); break;
-    case 8: I2C_LCD_DN_write8(col); break; 
-    case 9: I2C_LCD_DN_write9(col); break;
-    default:                                    // if number is not between 0-9 print Yen at given position
         I2C_startWait(I2C_LCD_ADDRESS & ~I2C_WRITE);   // start I2C connection to LCD
-        I2C_LCD_setCursorWOI2C(col, 1);                     // set cursor at top start position
-        // write needed chars in this line
-        I2C_LCD_write(B_SLASH);
-        I2C_LCD_write(' ');
-        I2C_LCD_write(' ');
-        I2C_LCD_write(F_SLASH);
-        I2C_LCD_setCursorWOI2C(col, 2);                     // set cursor at middle-top start position
-        // write needed chars in this line
-        I2C_LCD_write(' ');
-        I2C_LCD_write(B_SLASH);
-        I2C_LCD_write(F_SLASH);
-        I2C_LCD_write(' ');
-        I2C_LCD_setCursorWOI2C(col, 3);                     // set cursor at middle-bottom start position
-        // write needed chars in this line
-        I2C_LCD_write(UPPER_BAR);
-        I2C_LCD_write(RIGHT_BAR);
-        I2C_LCD_write(LEFT_BAR);
-        I2C_LCD_write(UPPER_BAR);
-        I2C_LCD_setCursorWOI2C(col, 4);                     // set cursor at bottom start position
-        // write needed chars in this line
-        I2C_LCD_write(UPPER_BAR);
-        I2C_LCD_write(RIGHT_BAR);
-        I2C_LCD_write(LEFT_BAR);
-        I2C_LCD_write(UPPER_BAR);
-        I2C_stop();                                    // stop I2C connection
-        break;
+        *started = 1;
     }
+    I2C_LCD_DN_render(glyph, dn_shown[pos], col);
+    dn_shown[pos] = glyph;
+}
+
+// left column of a position of the number layout
+static uint8_t I2C_LCD_DN_numberCol(uint8_t pos)
+{
+    return 1 + pos * (dn_font->width + 1);
 }
 
-void I2C_LCD_DN_write0(uint8_t col)
+// send the colon fields or spaces
+static void I2C_LCD_DN_colon(uint8_t show)
 {
+    const uint8_t *fields = dn_font->colon;
+
     I2C_startWait(I2C_LCD_ADDRESS & ~I2C_WRITE);   // start I2C connection to LCD
-    I2C_LCD_setCursorWOI2C(col, 1);                     // set cursor at top start position
-    // write needed chars in this line
-    I2C_LCD_write(FULL_BAR);
-    I2C_LCD_write(UPPER_BAR);
-    I2C_LCD_write(UPPER_BAR);
-    I2C_LCD_write(FULL_BAR);
-    I2C_LCD_setCursorWOI2C(col, 2);                     // set cursor at middle-top start position
-    // write needed chars in this line
-    I2C_LCD_write(FULL_BAR);
-    I2C_LCD_write(' ');
-    I2C_LCD_write(' ');
-    I2C_LCD_write(FULL_BAR);
-    I2C_LCD_setCursorWOI2C(col, 3);
-    I2C_LCD_write(FULL_BAR);
-    I2C_LCD_write(' ');
-    I2C_LCD_write(' ');
-    I2C_LCD_write(FULL_BAR);
-    I2C_LCD_setCursorWOI2C(col, 4);
-    I2C_LCD_write(FULL_BAR);
-    I2C_LCD_write(LOWER_BAR);
-    I2C_LCD_write(LOWER_BAR);
-    I2C_LCD_write(FULL_BAR);
+    for (uint8_t row = 1; row <= dn_font->height; row++)
+    {
+        uint8_t left = pgm_read_byte(fields++);
+        uint8_t right = pgm_read_byte(fields++);
+        if ((left == ' ') && (right == ' '))
+        {
+            continue;                                   // row is never used by the colon
+        }
+        I2C_LCD_setCursorWOI2C(dn_colonCol, row);
+        I2C_LCD_write(show ? left : ' ');
+        I2C_LCD_write(show ? right : ' ');
+    }
+    colonState = show;
     I2C_stop();                                    // stop I2C connection
 }
 
-void I2C_LCD_DN_write1(uint8_t col)
+void I2C_LCD_DN_init()
 {
-    I2C_startWait(I2C_LCD_ADDRESS & ~I2C_WRITE);
-    I2C_LCD_setCursorWOI2C(col, 1);                     // set cursor at top start position
-    // write needed chars in this line
-    I2C_LCD_write(' ');
-    I2C_LCD_write(' ');
-    I2C_LCD_write(' ');
-    I2C_LCD_write(FULL_BAR);
-    I2C_LCD_setCursorWOI2C(col, 2);                     // set cursor at middle-top start position
-    // write needed chars in this line
-    I2C_LCD_write(' ');
-    I2C_LCD_write(' ');
-    I2C_LCD_write(' ');
-    I2C_LCD_write(FULL_BAR);
-    I2C_LCD_setCursorWOI2C(col, 3);
-    I2C_LCD_write(' ');
-    I2C_LCD_write(' ');
-    I2C_LCD_write(' ');
-    I2C_LCD_write(FULL_BAR);
-    I2C_LCD_setCursorWOI2C(col, 4);
-    I2C_LCD_write(' ');
-    I2C_LCD_write(' ');
-    I2C_LCD_write(' ');
-    I2C_LCD_write(FULL_BAR);
-    I2C_stop();
+    I2C_LCD_DN_initFont(20, 4, &I2C_LCD_DN_font4x4);   // initialize display with 4 lines and 20 cols
+}
+
+uint8_t I2C_LCD_DN_initFont(uint8_t cols, uint8_t lines, const struct I2C_LCD_DN_font *font)
+{
+    I2C_LCD_init(cols, lines);  // initialize display
+    if (I2C_LCD_DN_setFont(font))   // initialize custom chars in the CGRAM
+    {
+        return 1;   // ERROR
+    }
+    I2C_LCD_DN_clearColon();    // clears the colon from the screen 
+    return 0;       // SUCCESS
+}
+
+uint8_t I2C_LCD_DN_setFont(const struct I2C_LCD_DN_font *font)
+{
+    uint8_t width = font->width;
+    uint8_t used = 4 * width + 4;                       // 4 numbers, 2 gaps and the colon
+    uint8_t left = (numcols > used) ? ((numcols - used) / 2 + 1) : 1;  // center on the display
+
+    if ((font->height > numlines) || (used > numcols))
+    {
+        return 1;   // ERROR: font does not fit on the display
+    }
+    I2C_LCD_DN_invalidate();    // numbers on the screen belong to the old font
+
+    dn_font = font;
+    dn_timeCols[0] = left;
+    dn_timeCols[1] = left + width + 1;
+    dn_colonCol = left + 2 * width + 1;
+    dn_timeCols[2] = left + 2 * width + 3;
+    dn_timeCols[3] = left + 3 * width + 4;
+
+    I2C_LCD_DN_customChars();   // send the custom chars of the font
+    return 0;       // SUCCESS
 }
 
-void I2C_LCD_DN_write2(uint8_t col)
+void I2C_LCD_DN_invalidate()
 {
-    I2C_startWait(I2C_LCD_ADDRESS & ~I2C_WRITE);
-    I2C_LCD_setCursorWOI2C(col, 1);                     // set cursor at top start position
-    // write needed chars in this line
-    I2C_LCD_write(UPPER_BAR);
-    I2C_LCD_write(UPPER_BAR);
-    I2C_LCD_write(UPPER_BAR);
-    I2C_LCD_write(FULL_BAR);
-    I2C_LCD_setCursorWOI2C(col, 2);                     // set cursor at middle-top start position
-    // write needed chars in this line
-    I2C_LCD_write(LOWER_BAR);
-    I2C_LCD_write(LOWER_BAR);
-    I2C_LCD_write(LOWER_BAR);
-    I2C_LCD_write(FULL_BAR);
-    I2C_LCD_setCursorWOI2C(col, 3);
-    I2C_LCD_write(FULL_BAR);
-    I2C_LCD_write(UPPER_BAR);
-    I2C_LCD_write(UPPER_BAR);
-    I2C_LCD_write(UPPER_BAR);
-    I2C_LCD_setCursorWOI2C(col, 4);
-    I2C_LCD_write(FULL_BAR);
-    I2C_LCD_write(LOWER_BAR);
-    I2C_LCD_write(LOWER_BAR);
-    I2C_LCD_write(LOWER_BAR);
-    I2C_stop();
+    if (dn_pointCol)                                    // the point is not part of a glyph
+    {
+        I2C_startWait(I2C_LCD_ADDRESS & ~I2C_WRITE);   // start I2C connection to LCD
+        I2C_LCD_setCursorWOI2C(dn_pointCol, dn_font->height);
+        I2C_LCD_write(' ');
+        I2C_stop();                                    // stop I2C connection
+    }
+    for (uint8_t i = 0; i < I2C_LCD_DN_POSITIONS; i++)
+    {
+        dn_shown[i] = I2C_LCD_DN_NONE;
+    }
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        dn_rollFrame[i] = DN_ROLL_IDLE;                 // rolling numbers are gone, too
+    }
+    dn_pointCol = 0;
 }
 
-void I2C_LCD_DN_write3(uint8_t col)
+// show 4 glyphs at the time positions, only the changed ones are sent
+static void I2C_LCD_DN_showGlyphs(const uint8_t *glyphs)
 {
-    I2C_startWait(I2C_LCD_ADDRESS & ~I2C_WRITE);
-    I2C_LCD_setCursorWOI2C(col, 1);                     // set cursor at top start position
-    // write needed chars in this line
-    I2C_LCD_write(UPPER_BAR);
-    I2C_LCD_write(UPPER_BAR);
-    I2C_LCD_write(UPPER_BAR);
-    I2C_LCD_write(FULL_BAR);
-    I2C_LCD_setCursorWOI2C(col, 2);                     // set cursor at middle-top start position
-    // write needed chars in this line
-    I2C_LCD_write(LOWER_BAR);
-    I2C_LCD_write(LOWER_BAR);
-    I2C_LCD_write(LOWER_BAR);
-    I2C_LCD_write(FULL_BAR);
-    I2C_LCD_setCursorWOI2C(col, 3);
-    I2C_LCD_write(UPPER_BAR);
-    I2C_LCD_write(UPPER_BAR);
-    I2C_LCD_write(UPPER_BAR);
-    I2C_LCD_write(FULL_BAR);
-    I2C_LCD_setCursorWOI2C(col, 4);
-    I2C_LCD_write(LOWER_BAR);
-    I2C_LCD_write(LOWER_BAR);
-    I2C_LCD_write(LOWER_BAR);
-    I2C_LCD_write(FULL_BAR);
-    I2C_stop();
+    uint8_t started = 0;
+
+    I2C_LCD_DN_layout(DN_LAYOUT_CLOCK);
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        dn_rollFrame[i] = DN_ROLL_IDLE;                 // a running roll is overwritten
+        I2C_LCD_DN_place(i, glyphs[i], dn_timeCols[i], &started);
+    }
+    if (started)
+    {
+        I2C_stop();                                    // stop I2C connection
+    }
 }
 
-void I2C_LCD_DN_write4(uint8_t col)
+void I2C_LCD_DN_showTime(uint8_t hh, uint8_t mm)
 {
-    I2C_startWait(I2C_LCD_ADDRESS & ~I2C_WRITE);
-    I2C_LCD_setCursorWOI2C(col, 1);                     // set cursor at top start position
-    // write needed chars in this line
-    I2C_LCD_write(FULL_BAR);
-    I2C_LCD_write(' ');
-    I2C_LCD_write(' ');
-    I2C_LCD_write(' ');
-    I2C_LCD_setCursorWOI2C(col, 2);                     // set cursor at middle-top start position
-    // write needed chars in this line
-    I2C_LCD_write(FULL_BAR);
-    I2C_LCD_write(' ');
-    I2C_LCD_write(FULL_BAR);
-    I2C_LCD_write(' ');
-    I2C_LCD_setCursorWOI2C(col, 3);
-    I2C_LCD_write(UPPER_BAR);
-    I2C_LCD_write(UPPER_BAR);
-    I2C_LCD_write(FULL_BAR);
-    I2C_LCD_write(UPPER_BAR);
-    I2C_LCD_setCursorWOI2C(col, 4);
-    I2C_LCD_write(' ');
-    I2C_LCD_write(' ');
-    I2C_LCD_write(FULL_BAR);
-    I2C_LCD_write(' ');
-    I2C_stop();
+    uint8_t glyphs[4] = {hh / 10, hh % 10, mm / 10, mm % 10};
+
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        if (glyphs[i] > 9)
+        {
+            glyphs[i] = I2C_LCD_DN_INVALID;
+        }
+    }
+    I2C_LCD_DN_showGlyphs(glyphs);
 }
 
-void I2C_LCD_DN_write5(uint8_t col)
+void I2C_LCD_DN_showNoTime()
 {
-    I2C_startWait(I2C_LCD_ADDRESS & ~I2C_WRITE);
-    I2C_LCD_setCursorWOI2C(col, 1);                     // set cursor at top start position
-    // write needed chars in this line
-    I2C_LCD_write(FULL_BAR);
-    I2C_LCD_write(UPPER_BAR);
-    I2C_LCD_write(UPPER_BAR);
-    I2C_LCD_write(UPPER_BAR);
-    I2C_LCD_setCursorWOI2C(col, 2);                     // set cursor at middle-top start position
-    // write needed chars in this line
-    I2C_LCD_write(FULL_BAR);
-    I2C_LCD_write(LOWER_BAR);
-    I2C_LCD_write(LOWER_BAR);
-    I2C_LCD_write(LOWER_BAR);
-    I2C_LCD_setCursorWOI2C(col, 3);
-    I2C_LCD_write(UPPER_BAR);
-    I2C_LCD_write(UPPER_BAR);
-    I2C_LCD_write(UPPER_BAR);
-    I2C_LCD_write(FULL_BAR);
-    I2C_LCD_setCursorWOI2C(col, 4);
-    I2C_LCD_write(LOWER_BAR);
-    I2C_LCD_write(LOWER_BAR);
-    I2C_LCD_write(LOWER_BAR);
-    I2C_LCD_write(FULL_BAR);
-    I2C_stop();
+    static const uint8_t glyphs[4] = {I2C_LCD_DN_MINUS, I2C_LCD_DN_MINUS, I2C_LCD_DN_MINUS, I2C_LCD_DN_MINUS};
+
+    I2C_LCD_DN_showGlyphs(glyphs);
 }
 
-void I2C_LCD_DN_write6(uint8_t col)
+void I2C_LCD_DN_rollTime(uint8_t hh, uint8_t mm)
 {
-    I2C_startWait(I2C_LCD_ADDRESS & ~I2C_WRITE);
-    I2C_LCD_setCursorWOI2C(col, 1);                     // set cursor at top start position
-    // write needed chars in this line
-    I2C_LCD_write(FULL_BAR);
-    I2C_LCD_write(UPPER_BAR);
-    I2C_LCD_write(UPPER_BAR);
-    I2C_LCD_write(UPPER_BAR);
-    I2C_LCD_setCursorWOI2C(col, 2);                     // set cursor at middle-top start position
-    // write needed chars in this line
-    I2C_LCD_write(FULL_BAR);
-    I2C_LCD_write(LOWER_BAR);
-    I2C_LCD_write(LOWER_BAR);
-    I2C_LCD_write(LOWER_BAR);
-    I2C_LCD_setCursorWOI2C(col, 3);
-    I2C_LCD_write(FULL_BAR);
-    I2C_LCD_write(UPPER_BAR);
-    I2C_LCD_write(UPPER_BAR);
-    I2C_LCD_write(FULL_BAR);
-    I2C_LCD_setCursorWOI2C(col, 4);
-    I2C_LCD_write(FULL_BAR);
-    I2C_LCD_write(LOWER_BAR);
-    I2C_LCD_write(LOWER_BAR);
-    I2C_LCD_write(FULL_BAR);
-    I2C_stop();
+    uint8_t numbers[4] = {hh / 10, hh % 10, mm / 10, mm % 10};
+    uint8_t height = dn_font->height;
+    uint8_t started = 0;
+
+    I2C_LCD_DN_layout(DN_LAYOUT_CLOCK);
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        uint8_t glyph = (numbers[i] > 9) ? I2C_LCD_DN_INVALID : numbers[i];
+        if (dn_rollFrame[i] != DN_ROLL_IDLE)
+        {
+            if (dn_rollNew[i] == glyph)
+            {
+                continue;                               // already rolling to this glyph
+            }
+            if (!started)
+            {
+                I2C_startWait(I2C_LCD_ADDRESS & ~I2C_WRITE);   // start I2C connection to LCD
+                started = 1;
+            }
+            I2C_LCD_DN_rollRender(i, dn_rollFrame[i], height);  // finish the old roll at once
+            dn_shown[i] = dn_rollNew[i];
+            dn_rollFrame[i] = DN_ROLL_IDLE;
+        }
+        if ((dn_shown[i] == I2C_LCD_DN_NONE) || (dn_shown[i] == glyph))
+        {
+            I2C_LCD_DN_place(i, glyph, dn_timeCols[i], &started);  // nothing to roll from
+            continue;
+        }
+        dn_rollOld[i] = dn_shown[i];
+        dn_rollNew[i] = glyph;
+        dn_rollFrame[i] = 0;                            // frame 0 is the old glyph on the display
+        dn_shown[i] = I2C_LCD_DN_NONE;                  // unknown until the roll is finished
+    }
+    if (started)
+    {
+        I2C_stop();                                    // stop I2C connection
+    }
 }
 
-void I2C_LCD_DN_write7(uint8_t col)
+uint8_t I2C_LCD_DN_rollTask()
 {
-    I2C_startWait(I2C_LCD_ADDRESS & ~I2C_WRITE);
-    I2C_LCD_setCursorWOI2C(col, 1);                     // set cursor at top start position
-    // write needed chars in this line
-    I2C_LCD_write(UPPER_BAR);
-    I2C_LCD_write(UPPER_BAR);
-    I2C_LCD_write(UPPER_BAR);
-    I2C_LCD_write(FULL_BAR);
-    I2C_LCD_setCursorWOI2C(col, 2);                     // set cursor at middle-top start position
-    // write needed chars in this line
-    I2C_LCD_write(' ');
-    I2C_LCD_write(' ');
-    I2C_LCD_write(' ');
-    I2C_LCD_write(FULL_BAR);
-    I2C_LCD_setCursorWOI2C(col, 3);
-    I2C_LCD_write(' ');
-    I2C_LCD_write(' ');
-    I2C_LCD_write(' ');
-    I2C_LCD_write(FULL_BAR);
-    I2C_LCD_setCursorWOI2C(col, 4);
-    I2C_LCD_write(' ');
-    I2C_LCD_write(' ');
-    I2C_LCD_write(' ');
-    I2C_LCD_write(FULL_BAR);
-    I2C_stop();
+    uint8_t height = dn_font->height;
+    uint8_t started = 0;
+
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        uint8_t frame = dn_rollFrame[i];
+        if (frame == DN_ROLL_IDLE)
+        {
+            continue;
+        }
+        if (!started)
+        {
+            I2C_startWait(I2C_LCD_ADDRESS & ~I2C_WRITE);   // start I2C connection to LCD
+            started = 1;
+        }
+        I2C_LCD_DN_rollRender(i, frame, frame + 1);     // only the fields changed by one step
+        if (++frame >= height)
+        {
+            dn_shown[i] = dn_rollNew[i];                // last frame is the new glyph
+            frame = DN_ROLL_IDLE;
+        }
+        dn_rollFrame[i] = frame;
+    }
+    if (started)
+    {
+        I2C_stop();                                    // stop I2C connection
+    }
+    return started;
 }
 
-void I2C_LCD_DN_write8(uint8_t col)
+void I2C_LCD_DN_printNumber(int32_t value, uint8_t width, uint8_t decimals, uint8_t align)
 {
-    I2C_startWait(I2C_LCD_ADDRESS & ~I2C_WRITE);
-    I2C_LCD_setCursorWOI2C(col, 1);                     // set cursor at top start position
-    // write needed chars in this line
-    I2C_LCD_write(FULL_BAR);
-    I2C_LCD_write(UPPER_BAR);
-    I2C_LCD_write(UPPER_BAR);
-    I2C_LCD_write(FULL_BAR);
-    I2C_LCD_setCursorWOI2C(col, 2);                     // set cursor at middle-top start position
-    // write needed chars in this line
-    I2C_LCD_write(FULL_BAR);
-    I2C_LCD_write(LOWER_BAR);
-    I2C_LCD_write(LOWER_BAR);
-    I2C_LCD_write(FULL_BAR);
-    I2C_LCD_setCursorWOI2C(col, 3);
-    I2C_LCD_write(FULL_BAR);
-    I2C_LCD_write(UPPER_BAR);
-    I2C_LCD_write(UPPER_BAR);
-    I2C_LCD_write(FULL_BAR);
-    I2C_LCD_setCursorWOI2C(col, 4);
-    I2C_LCD_write(FULL_BAR);
-    I2C_LCD_write(LOWER_BAR);
-    I2C_LCD_write(LOWER_BAR);
-    I2C_LCD_write(FULL_BAR);
-    I2C_stop();
+    uint8_t negative = (value < 0);
+    uint32_t magnitude = negative ? (0UL - (uint32_t)value) : (uint32_t)value;
+    uint8_t digits = I2C_LCD_decimalLength(magnitude);
+    uint8_t maxWidth = (numcols + 1) / (dn_font->width + 1);
+    uint8_t started = 0;
+
+    width = (width > maxWidth) ? maxWidth : width;      // limit to the display width
+    width = (width > I2C_LCD_DN_POSITIONS) ? I2C_LCD_DN_POSITIONS : width;
+    if (digits <= decimals)                             // keep one zero in front of the point
+    {
+        digits = decimals + 1;
+    }
+    uint8_t used = digits + negative;
+    uint8_t overflow = (used > width);
+    uint8_t first = (overflow || (align == I2C_LCD_DN_ALIGN_LEFT)) ? 0 : (width - used);
+    uint8_t pointCol = 0;
+
+    I2C_LCD_DN_layout(DN_LAYOUT_NUMBER);
+    for (uint8_t pos = 0; pos < width; pos++)
+    {
+        uint8_t glyph = I2C_LCD_DN_BLANK;               // leading and trailing positions are blank
+        if (overflow)
+        {
+            glyph = I2C_LCD_DN_INVALID;
+        }
+        else if ((pos == first) && negative)
+        {
+            glyph = I2C_LCD_DN_MINUS;
+        }
+        else if ((pos >= first + negative) && (pos < first + used))
+        {
+            digits--;                                   // decimal place of this position
+            glyph = I2C_LCD_decimalDigit(&magnitude, digits);
+            if (decimals && (digits == decimals))
+            {
+                pointCol = I2C_LCD_DN_numberCol(pos) + dn_font->width;  // point in the gap behind
+            }
+        }
+        I2C_LCD_DN_place(pos, glyph, I2C_LCD_DN_numberCol(pos), &started);
+    }
+
+    if (pointCol != dn_pointCol)                        // move the decimal point
+    {
+        if (!started)
+        {
+            I2C_startWait(I2C_LCD_ADDRESS & ~I2C_WRITE);   // start I2C connection to LCD
+            started = 1;
+        }
+        if (dn_pointCol)
+        {
+            I2C_LCD_setCursorWOI2C(dn_pointCol, dn_font->height);
+            I2C_LCD_write(' ');
+        }
+        if (pointCol)
+        {
+            I2C_LCD_setCursorWOI2C(pointCol, dn_font->height);
+            I2C_LCD_write('.');
+        }
+        dn_pointCol = pointCol;
+    }
+    if (started)
+    {
+        I2C_stop();                                    // stop I2C connection
+    }
 }
 
-void I2C_LCD_DN_write9(uint8_t col)
+void I2C_LCD_DN_printGlyph(uint8_t glyph, uint8_t pos)
 {
-    I2C_startWait(I2C_LCD_ADDRESS & ~I2C_WRITE);
-    I2C_LCD_setCursorWOI2C(col, 1);                     // set cursor at top start position
-    // write needed chars in this line
-    I2C_LCD_write(FULL_BAR);
-    I2C_LCD_write(UPPER_BAR);
-    I2C_LCD_write(UPPER_BAR);
-    I2C_LCD_write(FULL_BAR);
-    I2C_LCD_setCursorWOI2C(col, 2);                     // set cursor at middle-top start position
-    // write needed chars in this line
-    I2C_LCD_write(FULL_BAR);
-    I2C_LCD_write(LOWER_BAR);
-    I2C_LCD_write(LOWER_BAR);
-    I2C_LCD_write(FULL_BAR);
-    I2C_LCD_setCursorWOI2C(col, 3);
-    I2C_LCD_write(UPPER_BAR);
-    I2C_LCD_write(UPPER_BAR);
-    I2C_LCD_write(UPPER_BAR);
-    I2C_LCD_write(FULL_BAR);
-    I2C_LCD_setCursorWOI2C(col, 4);
-    I2C_LCD_write(LOWER_BAR);
-    I2C_LCD_write(LOWER_BAR);
-    I2C_LCD_write(LOWER_BAR);
-    I2C_LCD_write(FULL_BAR);
-    I2C_stop();
+    uint8_t started = 0;
+
+    if ((glyph >= I2C_LCD_DN_GLYPHS) || (pos >= I2C_LCD_DN_POSITIONS))
+    {
+        return;
+    }
+    I2C_LCD_DN_layout(DN_LAYOUT_NUMBER);
+    I2C_LCD_DN_place(pos, glyph, I2C_LCD_DN_numberCol(pos), &started);
+    if (started)
+    {
+        I2C_stop();                                    // stop I2C connection
+    }
 }
 
-void I2C_LCD_DN_printColon()
+void I2C_LCD_DN_customChars()
 {
-    I2C_startWait(I2C_LCD_ADDRESS & ~I2C_WRITE);
+    for (uint8_t i = dn_font->numChars; i < dn_numChars; i++)
+    {
+        I2C_LCD_glyphFree(i);   // not used by this font, back to the glyph manager
+    }
+    dn_numChars = dn_font->numChars;
 
-    I2C_LCD_setCursorWOI2C(COLON_COL, 2);
-    I2C_LCD_write(RIGHT_DOT);
-    I2C_LCD_write(LEFT_DOT);
-    I2C_LCD_setCursorWOI2C(COLON_COL, 3);
-    I2C_LCD_write(RIGHT_DOT);
-    I2C_LCD_write(LEFT_DOT);
-    colonState = 1;
+    // push all custom chars in one row to the CGRAM
+    I2C_LCD_createChars_P(0, dn_font->numChars, dn_font->chars);
+}
 
-    I2C_stop();
+void I2C_LCD_DN_write(uint8_t num, uint8_t col)
+{
+    I2C_startWait(I2C_LCD_ADDRESS & ~I2C_WRITE);   // start I2C connection to LCD
+    I2C_LCD_DN_render((num > 9) ? I2C_LCD_DN_INVALID : num, I2C_LCD_DN_NONE, col);  // numbers above 9 are printed as Yen
+    I2C_stop();                                    // stop I2C connection
 }
 
-void I2C_LCD_DN_clearColon()
+void I2C_LCD_DN_writeGlyph(uint8_t glyph, uint8_t col)
 {
-    I2C_startWait(I2C_LCD_ADDRESS & ~I2C_WRITE);
+    if (glyph >= I2C_LCD_DN_GLYPHS)
+    {
+        glyph = I2C_LCD_DN_INVALID;
+    }
+    I2C_startWait(I2C_LCD_ADDRESS & ~I2C_WRITE);   // start I2C connection to LCD
+    I2C_LCD_DN_render(glyph, I2C_LCD_DN_NONE, col);
+    I2C_stop();                                    // stop I2C connection
+}
 
-    I2C_LCD_setCursorWOI2C(COLON_COL, 2);
-    I2C_LCD_write(' ');
-    I2C_LCD_write(' ');
-    I2C_LCD_setCursorWOI2C(COLON_COL, 3);
-    I2C_LCD_write(' ');
-    I2C_LCD_write(' ');
-    colonState = 0;
+void I2C_LCD_DN_printColon()
+{
+    I2C_LCD_DN_colon(1);
+}
 
-    I2C_stop();
+void I2C_LCD_DN_clearColon()
+{
+    I2C_LCD_DN_colon(0);
 }
 
 void I2C_LCD_DN_toggleColon()
 {
-    I2C_startWait(I2C_LCD_ADDRESS & ~I2C_WRITE);
-    if (colonState)
+    if (colonState)     // print/clear open their own I2C connection
     {
         I2C_LCD_DN_clearColon();
     }
@@ -417,7 +881,6 @@ void I2C_LCD_DN_toggleColon()
     {
         I2C_LCD_DN_printColon();
     }
-    I2C_stop();
 }
 
 /**
@@ -13,6 +13,7 @@
  * 
  * The I2C library from clefa is used for the I2C-connection.
  * The I2C-LCD initialization for a 4x20 LCD is already integrated in this Library.
+ * Other display sizes (f.e. 2x16) are supported with the fonts 3x3 and 3x2.
  */
 
 
@@ -22,7 +23,7 @@
 
 #include "I2C_LCD.h"                    // requires LCD over I2C
 
-// CGRAM addresses of the custom characters
+// CGRAM addresses of the custom characters (font 4x4)
 #define FULL_BAR    0xFF
 #define UPPER_BAR   0
 #define LOWER_BAR   1
@@ -33,109 +34,196 @@
 #define B_SLASH     6
 #define F_SLASH     7
 
-// left column of the colon
+// left column of the colon (font 4x4 on a 4x20 LCD)
 #define COLON_COL   10
 
+// glyphs behind the numbers 0 - 9
+#define I2C_LCD_DN_INVALID  10          // Yen, shown for invalid numbers
+#define I2C_LCD_DN_BLANK    11
+#define I2C_LCD_DN_MINUS    12
+#define I2C_LCD_DN_DEGREE   13
+#define I2C_LCD_DN_C        14
+#define I2C_LCD_DN_F        15
+#define I2C_LCD_DN_E        16
+#define I2C_LCD_DN_H        17
+#define I2C_LCD_DN_L        18
+#define I2C_LCD_DN_P        19
+#define I2C_LCD_DN_GLYPHS   20          // number of glyphs in each font
+
+// max. number of glyph positions in a row
+#define I2C_LCD_DN_POSITIONS    10
+
+// alignment for I2C_LCD_DN_printNumber
+#define I2C_LCD_DN_ALIGN_RIGHT  0
+#define I2C_LCD_DN_ALIGN_LEFT   1
+
+// marks a position where the shown number is unknown
+#define I2C_LCD_DN_NONE     0xFF
+
+/** @brief font with big numbers made of custom chars */
+struct I2C_LCD_DN_font
+{
+    uint8_t width;                      // fields per row of a number
+    uint8_t height;                     // rows of a number
+    uint8_t numChars;                   // number of custom chars (CGRAM 0 - numChars-1)
+    const uint8_t *chars;               // custom chars, 8 lines each (PROGMEM)
+    const uint8_t *glyphs;              // width * height fields per glyph (PROGMEM)
+    const uint8_t *colon;               // 2 * height fields of the colon (PROGMEM)
+};
+
+/** @brief numbers with 4x4 fields for 4x20 LCDs (default) */
+extern const struct I2C_LCD_DN_font I2C_LCD_DN_font4x4;
+/** @brief numbers with 3x3 fields, f.e. 4x20 LCDs with a status line */
+extern const struct I2C_LCD_DN_font I2C_LCD_DN_font3x3;
+/** @brief numbers with 3x2 fields for 2x16 LCDs */
+extern const struct I2C_LCD_DN_font I2C_LCD_DN_font3x2;
+
 /** ===================================================
  * @brief function to initialize the display,
  * create the custom chars and
  * clear the colon.
+ * 4x20 LCD with the font 4x4
  */
 void I2C_LCD_DN_init();
 
 /** ===================================================
- * @brief function to write all needed 
- * custom chars to the CGRAM of the LCD.
+ * @brief function to initialize the display
+ * with a given size and font,
+ * create the custom chars and clear the colon.
+ * 
+ * @param cols  LCD Colums
+ * @param lines LCD Rows (>= height of the font)
+ * @param font  I2C_LCD_DN_font4x4, I2C_LCD_DN_font3x3 or I2C_LCD_DN_font3x2
+ * @return uint8_t success = 0, 1 if the font is higher than the display
+ * or the time (4 * font width + 4 columns) is wider than the display
  */
-void I2C_LCD_DN_customChars();
+uint8_t I2C_LCD_DN_initFont(uint8_t cols, uint8_t lines, const struct I2C_LCD_DN_font *font);
 
 /** ===================================================
- * @brief function to write specific number to the LCD
+ * @brief function to change the font on an initialized display.
+ * The custom chars are sent and the positions of the
+ * numbers and the colon are calculated from the display size.
+ * CGRAM locations not used by the new font are given
+ * back to the glyph manager.
  * 
- * @param num which number
- * @param col left column of number
+ * @param font I2C_LCD_DN_font4x4, I2C_LCD_DN_font3x3 or I2C_LCD_DN_font3x2
+ * @return uint8_t success = 0, 1 if the font is higher than the display
+ * or the time (4 * font width + 4 columns) is wider than the display
+ * (the current font is kept)
  */
-void I2C_LCD_DN_write(uint8_t num, uint8_t col);
+uint8_t I2C_LCD_DN_setFont(const struct I2C_LCD_DN_font *font);
 
 /** ===================================================
- * @brief function to write a ZERO 
- * with 4x4 fields to the LCD
- * 
- * @param col left column of number
+ * @brief function to write all needed 
+ * custom chars of the font to the CGRAM of the LCD.
  */
-void I2C_LCD_DN_write0(uint8_t col);
+void I2C_LCD_DN_customChars();
 
 /** ===================================================
- * @brief function to write a ONE
- * with 4x4 fields to the LCD
+ * @brief function to write specific number
+ * with the fields of the font to the LCD.
+ * Numbers above 9 are printed as invalid (Yen).
  * 
+ * @param num which number
  * @param col left column of number
  */
-void I2C_LCD_DN_write1(uint8_t col);
+void I2C_LCD_DN_write(uint8_t num, uint8_t col);
 
 /** ===================================================
- * @brief function to write a TWO 
- * with 4x4 fields to the LCD
+ * @brief function to show the time with 4 numbers
+ * and the colon in between. Only the numbers which changed
+ * are sent and within them only the changed fields,
+ * everything in one I2C connection.
  * 
- * @param col left column of number
+ * @param hh hours 0 - 99
+ * @param mm minutes 0 - 99
  */
-void I2C_LCD_DN_write2(uint8_t col);
+void I2C_LCD_DN_showTime(uint8_t hh, uint8_t mm);
 
 /** ===================================================
- * @brief function to write a THREE
- * with 4x4 fields to the LCD
- * 
- * @param col left column of number
+ * @brief function to show "--:--" instead of the time,
+ * f.e. if the RTC lost the time (I2C_RTC_timeValid).
+ * The next I2C_LCD_DN_showTime sends only the changed numbers.
  */
-void I2C_LCD_DN_write3(uint8_t col);
+void I2C_LCD_DN_showNoTime();
 
 /** ===================================================
- * @brief function to write a FOUR
- * with 4x4 fields to the LCD
+ * @brief function to show the time like I2C_LCD_DN_showTime,
+ * but changed numbers roll up: the old number slides out at the top
+ * while the new one slides in from below, one row per frame.
+ * Nothing is sent here for a changed number, call I2C_LCD_DN_rollTask
+ * for every frame. A number still rolling to another value is
+ * finished at once.
  * 
- * @param col left column of number
+ * @param hh hours 0 - 99
+ * @param mm minutes 0 - 99
  */
-void I2C_LCD_DN_write4(uint8_t col);
+void I2C_LCD_DN_rollTime(uint8_t hh, uint8_t mm);
 
 /** ===================================================
- * @brief function to write a FIVE
- * with 4x4 fields to the LCD
+ * @brief function to send the next frame of all rolling numbers
+ * in one I2C connection. Only the fields changed by the step are sent,
+ * at most width * height fields and height cursor commands per number.
+ * Call it from the main loop at the frame rate (f.e. every 50 ms),
+ * a roll takes font height frames.
  * 
- * @param col left column of number
+ * @return 1 a frame was sent, 0 nothing is rolling
  */
-void I2C_LCD_DN_write5(uint8_t col);
+uint8_t I2C_LCD_DN_rollTask();
 
 /** ===================================================
- * @brief function to write a SIX
- * with 4x4 fields to the LCD
+ * @brief function to show a signed number with big glyphs.
+ * Position p starts at column 1 + p * (font width + 1),
+ * the decimal point is printed in the gap behind the last integer digit.
+ * Leading zeros are blank, too big numbers are shown as Yen.
+ * Only changed glyphs and within them only changed fields are sent.
+ * Clear the display when switching from I2C_LCD_DN_showTime.
  * 
- * @param col left column of number
+ * @param value number, scaled by 10^decimals
+ * @param width number of positions incl. minus
+ * @param decimals digits behind the point
+ * @param align I2C_LCD_DN_ALIGN_RIGHT / I2C_LCD_DN_ALIGN_LEFT
  */
-void I2C_LCD_DN_write6(uint8_t col);
+void I2C_LCD_DN_printNumber(int32_t value, uint8_t width, uint8_t decimals, uint8_t align);
 
 /** ===================================================
- * @brief function to write a SEVEN
- * with 4x4 fields to the LCD
+ * @brief function to show a glyph (f.e. unit)
+ * at a position of I2C_LCD_DN_printNumber
+ * Nothing is sent if the glyph is already shown.
  * 
- * @param col left column of number
+ * @param glyph 0 - 9 or I2C_LCD_DN_BLANK, _MINUS, _DEGREE, _C, ...
+ * @param pos position 0 - (I2C_LCD_DN_POSITIONS-1)
  */
-void I2C_LCD_DN_write7(uint8_t col);
+void I2C_LCD_DN_printGlyph(uint8_t glyph, uint8_t pos);
 
 /** ===================================================
- * @brief function to write a EIGHT
- * with 4x4 fields to the LCD
+ * @brief function to write a glyph at a column
  * 
- * @param col left column of number
+ * @param glyph 0 - 9 or I2C_LCD_DN_BLANK, _MINUS, _DEGREE, _C, ...
+ * @param col left column of the glyph
  */
-void I2C_LCD_DN_write8(uint8_t col);
+void I2C_LCD_DN_writeGlyph(uint8_t glyph, uint8_t col);
 
 /** ===================================================
- * @brief function to write a NINE
- * with 4x4 fields to the LCD
- * 
- * @param col left column of number
+ * @brief function to forget the glyphs shown by
+ * I2C_LCD_DN_showTime and I2C_LCD_DN_printNumber,
+ * the next call prints all glyphs.
+ * A decimal point on the display is erased.
+ * Needed after the display was cleared or overwritten.
  */
-void I2C_LCD_DN_write9(uint8_t col);
+void I2C_LCD_DN_invalidate();
+
+// compatibility macros for the former single number functions
+#define I2C_LCD_DN_write0(col) I2C_LCD_DN_write(0, (col))
+#define I2C_LCD_DN_write1(col) I2C_LCD_DN_write(1, (col))
+#define I2C_LCD_DN_write2(col) I2C_LCD_DN_write(2, (col))
+#define I2C_LCD_DN_write3(col) I2C_LCD_DN_write(3, (col))
+#define I2C_LCD_DN_write4(col) I2C_LCD_DN_write(4, (col))
+#define I2C_LCD_DN_write5(col) I2C_LCD_DN_write(5, (col))
+#define I2C_LCD_DN_write6(col) I2C_LCD_DN_write(6, (col))
+#define I2C_LCD_DN_write7(col) I2C_LCD_DN_write(7, (col))
+#define I2C_LCD_DN_write8(col) I2C_LCD_DN_write(8, (col))
+#define I2C_LCD_DN_write9(col) I2C_LCD_DN_write(9, (col))
 
 /** ===================================================
  * @brief function to print a colon over 
@@ -0,0 +1,176 @@
+/**
+ * @file I2C_LCD_SW.c
+ *
+ * @author ClefaMedia
+ *
+ * @version 1.0
+ *
+ * @copyright
+ * Copyright (C) ClefaMedia 2021.
+ * All Rights GNU GLP Licensed.
+ *
+ * @brief This library was created to run a stopwatch or a countdown
+ * with 1/10 seconds in big numbers (I2C_LCD_DN).
+ *
+ * Timer1 counts the tenths with 10Hz in the background, all I2C work
+ * is done in I2C_LCD_SW_task. The number is drawn with I2C_LCD_DN_printNumber,
+ * so a tick only sends the tenths and the higher numbers which carried.
+ *
+ * The worst case of one tick (every position changes) is calculated from
+ * the font size and the I2C clock at compile time and has to fit in 100ms.
+ *
+ * This library uses the TIMER1_COMPA interrupt vector.
+ */
+
+
+#include "I2C_LCD_SW.h"
+#include "I2C_LCD_DN.h"
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+
+// prescaler 256, compare match with 10Hz
+#define SW_PRESCALER    256UL
+#define SW_COMPARE      (F_CPU / SW_PRESCALER / 10UL - 1UL)
+
+// queued work for I2C_LCD_SW_task
+#define SW_DRAW         0x01            // time has changed
+#define SW_DONE         0x02            // countdown reached 0.0
+
+static volatile uint32_t sw_tenths;     // counted time in 1/10 seconds
+static volatile uint8_t sw_running;     // timer counts
+static volatile uint8_t sw_pending;     // queued work (bitmask)
+static uint8_t sw_mode;                 // I2C_LCD_SW_STOPWATCH / I2C_LCD_SW_COUNTDOWN
+static uint32_t sw_max;                 // highest number of I2C_LCD_SW_WIDTH positions
+
+ISR(TIMER1_COMPA_vect)
+{
+    if (!sw_running)
+    {
+        return;
+    }
+    if (sw_mode == I2C_LCD_SW_COUNTDOWN)
+    {
+        if (sw_tenths)
+        {
+            sw_tenths--;
+        }
+        if (!sw_tenths)
+        {
+            sw_running = 0;
+            sw_pending |= SW_DONE;
+        }
+    }
+    else if (sw_tenths < sw_max)
+    {
+        sw_tenths++;
+    }
+    else
+    {
+        sw_running = 0;                 // stopwatch is full
+    }
+    sw_pending |= SW_DRAW;
+}
+
+// stop and set the time in a mode
+static void I2C_LCD_SW_set(uint8_t mode, uint32_t tenths)
+{
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        sw_running = 0;
+        sw_mode = mode;
+        sw_tenths = (tenths > sw_max) ? sw_max : tenths;
+        sw_pending = SW_DRAW;
+    }
+}
+
+void I2C_LCD_SW_init(void)
+{
+    sw_max = 1;
+    for (uint8_t i = 0; i < I2C_LCD_SW_WIDTH; i++)
+    {
+        sw_max *= 10;
+    }
+    sw_max--;
+
+    TCCR1A = 0x00;
+    TCCR1B = (1 << WGM12) | (1 << CS12);    // CTC mode, prescaler 256
+    OCR1A = SW_COMPARE;                     // 10Hz
+    TIFR1 = (1 << OCF1A);                   // clear old interrupt
+    TIMSK1 |= (1 << OCIE1A);                // enable interrupt
+
+    I2C_LCD_SW_reset();
+    I2C_LCD_SW_task();
+}
+
+void I2C_LCD_SW_reset(void)
+{
+    I2C_LCD_SW_set(I2C_LCD_SW_STOPWATCH, 0);
+}
+
+void I2C_LCD_SW_countdown(uint32_t tenths)
+{
+    I2C_LCD_SW_set(I2C_LCD_SW_COUNTDOWN, tenths);
+}
+
+void I2C_LCD_SW_start(void)
+{
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        TCNT1 = 0;                          // first tick after a full 1/10 second
+        TIFR1 = (1 << OCF1A);
+        sw_running = 1;
+    }
+}
+
+void I2C_LCD_SW_stop(void)
+{
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        sw_running = 0;
+    }
+}
+
+uint32_t I2C_LCD_SW_read(void)
+{
+    uint32_t tenths;
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        tenths = sw_tenths;
+    }
+    return tenths;
+}
+
+uint8_t I2C_LCD_SW_task(void)
+{
+    uint8_t pending;
+    uint32_t tenths;
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        pending = sw_pending;               // take the queued work
+        sw_pending = 0;
+        tenths = sw_tenths;
+    }
+
+    if (pending & SW_DRAW)                  // only the changed numbers are sent
+    {
+        I2C_LCD_DN_printNumber(tenths, I2C_LCD_SW_WIDTH, 1, I2C_LCD_DN_ALIGN_RIGHT);
+    }
+    return (pending & SW_DONE) ? 1 : 0;
+}
+
+/**
+ * This file is part of I2C_LCD_SW Library
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
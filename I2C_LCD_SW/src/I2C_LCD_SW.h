@@ -0,0 +1,138 @@
+/**
+ * @file I2C_LCD_SW.h
+ *
+ * @author ClefaMedia
+ *
+ * @version 1.0
+ *
+ * @copyright
+ * Copyright (C) ClefaMedia 2021.
+ * All Rights GNU GLP Licensed.
+ *
+ * @brief This library was created to run a stopwatch or a countdown
+ * with 1/10 seconds in big numbers (I2C_LCD_DN).
+ *
+ * Timer1 counts the tenths with 10Hz in the background, all I2C work
+ * is done in I2C_LCD_SW_task. The number is drawn with I2C_LCD_DN_printNumber,
+ * so a tick only sends the tenths and the higher numbers which carried.
+ *
+ * The worst case of one tick (every position changes) is calculated from
+ * the font size and the I2C clock at compile time and has to fit in 100ms.
+ *
+ * This library uses the TIMER1_COMPA interrupt vector.
+ */
+
+
+#ifndef _I2C_LCD_SW_H                   // prevents duplicate
+#define _I2C_LCD_SW_H   1               // forward declarations
+
+#include <avr/io.h>                     // requires AVR Input/Output
+#include <inttypes.h>                   // requires Inttypes
+
+// positions of the number incl. the tenths (I2C_LCD_DN_printNumber)
+#ifndef I2C_LCD_SW_WIDTH
+#define I2C_LCD_SW_WIDTH    4
+#endif
+
+// size of the font in use, can be defined for I2C_LCD_DN_font3x3 / _font3x2
+#ifndef I2C_LCD_SW_FONT_WIDTH
+#define I2C_LCD_SW_FONT_WIDTH   4
+#endif
+#ifndef I2C_LCD_SW_FONT_HEIGHT
+#define I2C_LCD_SW_FONT_HEIGHT  4
+#endif
+
+// SCL clock the I2C-Bus was initialized with
+#ifndef I2C_LCD_SW_SCL
+#define I2C_LCD_SW_SCL      100000UL
+#endif
+
+// time of one tick in us
+#define I2C_LCD_SW_TICK_US  100000UL
+
+// one field or cursor command: 4 expander bytes of 9 bits and 2 x 100us processing time
+#define I2C_LCD_SW_FIELD_US     (4UL * 9UL * 1000000UL / I2C_LCD_SW_SCL + 200UL)
+
+// worst case of one tick: all fields and a cursor command for each row of every position,
+// the decimal point (cursor + field) and the start condition with the address
+#define I2C_LCD_SW_WORST_US     ((I2C_LCD_SW_WIDTH * (I2C_LCD_SW_FONT_WIDTH + 1UL) * I2C_LCD_SW_FONT_HEIGHT + 2UL) \
+                                    * I2C_LCD_SW_FIELD_US + 2UL * 9UL * 1000000UL / I2C_LCD_SW_SCL)
+
+#if I2C_LCD_SW_WORST_US > I2C_LCD_SW_TICK_US
+#error "I2C_LCD_SW: one tick can not be drawn within 100ms, use less positions, a smaller font or a faster SCL"
+#endif
+
+// modes
+#define I2C_LCD_SW_STOPWATCH    0
+#define I2C_LCD_SW_COUNTDOWN    1
+
+/** ===================================================
+ * @brief function to start Timer1 with 10Hz
+ * and draw 0.0 as stopwatch (stopped).
+ *
+ * The I2C-Bus and the display (I2C_LCD_DN_init / I2C_LCD_DN_initFont)
+ * must be initialized before.
+ * Global interrupts must be enabled with sei().
+ */
+void I2C_LCD_SW_init(void);
+
+/** ===================================================
+ * @brief function to stop and set the stopwatch to 0.0
+ */
+void I2C_LCD_SW_reset(void);
+
+/** ===================================================
+ * @brief function to stop and set a countdown
+ *
+ * @param tenths start value in 1/10 seconds
+ */
+void I2C_LCD_SW_countdown(uint32_t tenths);
+
+/** ===================================================
+ * @brief function to start counting
+ */
+void I2C_LCD_SW_start(void);
+
+/** ===================================================
+ * @brief function to stop counting
+ */
+void I2C_LCD_SW_stop(void);
+
+/** ===================================================
+ * @brief function to read the counted time
+ *
+ * @return time in 1/10 seconds
+ */
+uint32_t I2C_LCD_SW_read(void);
+
+/** ===================================================
+ * @brief function to draw the changed numbers.
+ * Has to be called in the main loop,
+ * returns at once if nothing changed.
+ * Missed ticks are not lost, the current time is drawn.
+ * The stopwatch stops at the highest number of I2C_LCD_SW_WIDTH
+ * positions, the countdown at 0.0.
+ *
+ * @return 1 once when the countdown reached 0.0, else 0
+ */
+uint8_t I2C_LCD_SW_task(void);
+
+#endif                               // end prevent duplicate forward
+/* _I2C_LCD_SW_H */                  // declarations block
+
+/**
+ * This file is part of I2C_LCD_SW Library
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
@@ -0,0 +1,611 @@
+#include "I2C_RTC.h"        // Requires header file
+#include <I2C.h>            // Requires I2C by clefa
+#include <avr/pgmspace.h>   // Requires PROGMEM
+#include <util/atomic.h>    // Requires atomic blocks
+#include <avr/interrupt.h>  // Requires interrupts
+#include <avr/sleep.h>      // Requires sleep modes
+#include <util/delay.h>     // Requires delay
+
+// days from 1970-01-01 to 1996-03-01, the years of the calculation start with March 1996
+#define I2C_RTC_DAYS_1996   9556
+
+// max. polls of BSY and CONV 1ms apart, a temperature conversion takes up to 200ms
+#define I2C_RTC_CONVERT_POLLS   250
+
+// max. polls of the seconds 1ms apart, the next second starts within 1s
+#define I2C_RTC_SECOND_POLLS    1100
+
+// days of the months (February without leap day)
+static const uint8_t I2C_RTC_monthLength[12] PROGMEM = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+
+// software clock, changed by I2C_RTC_clockTick in the interrupt, read in atomic blocks
+static struct rtc_datetime clock_now;
+static uint8_t clock_minutes;                   // minutes since the last resync
+static uint8_t clock_resyncMinutes;             // minutes between two resyncs (0 = on demand)
+static volatile uint8_t clock_resync;           // resync is due
+static int32_t clock_drift;                     // software clock - RTC in seconds at the last resync
+
+static volatile uint8_t alarm_wakeup;           // INT0 interrupt of an alarm happened
+
+static uint32_t calib_rtc;                      // RTC epoch seconds at the start of the calibration
+static uint32_t calib_ref;                      // reference in ms at the start of the calibration
+
+// convert a binary value 0 - 99 to BCD
+static uint8_t I2C_RTC_bcd(uint8_t value) {
+    return (value%10) | (value/10)<<4;
+}
+
+// convert BCD to binary without branches: tens are counted with 16 instead of 10
+static uint8_t I2C_RTC_bin(uint8_t bcd) {
+    return bcd - 6 * (bcd >> 4);
+}
+
+// formats
+I2C_RTC_FORMAT(I2C_RTC_fmtTime, I2C_RTC_FMT_HOUR, ':', I2C_RTC_FMT_MIN, ':', I2C_RTC_FMT_SEC);
+I2C_RTC_FORMAT(I2C_RTC_fmtHHMM, I2C_RTC_FMT_HOUR, ':', I2C_RTC_FMT_MIN);
+I2C_RTC_FORMAT(I2C_RTC_fmtDate, I2C_RTC_FMT_DATE, '.', I2C_RTC_FMT_MONTH, '.', I2C_RTC_FMT_YEAR);
+I2C_RTC_FORMAT(I2C_RTC_fmtDDMM, I2C_RTC_FMT_DATE, '.', I2C_RTC_FMT_MONTH, '.');
+I2C_RTC_FORMAT(I2C_RTC_fmtYMD, I2C_RTC_FMT_YEAR4, '-', I2C_RTC_FMT_MONTH, '-', I2C_RTC_FMT_DATE);
+I2C_RTC_FORMAT(I2C_RTC_fmtISO8601, I2C_RTC_FMT_YEAR4, '-', I2C_RTC_FMT_MONTH, '-', I2C_RTC_FMT_DATE,
+    'T', I2C_RTC_FMT_HOUR, ':', I2C_RTC_FMT_MIN, ':', I2C_RTC_FMT_SEC, 'Z');
+
+// write the chars of an opcode, returns the number of chars (max. 4)
+static uint8_t I2C_RTC_field(uint8_t op, const struct rtc_datetime *dt, char *text) {
+    if (op < 0x80) {
+        *text = op;                                     // plain char
+        return 1;
+    }
+
+    uint8_t value = ((const uint8_t *)dt)[op & 0x0F];  // field at its offset in the struct
+    uint8_t tens = (value * 205U) >> 11;                // value / 10 for 0 - 99 without a division
+    char *start = text;
+
+    if (op & 0x10) {                                    // 4 digit year
+        *text++ = '2';
+        *text++ = '0';
+    }
+    if (!(op & 0x20)) {                                 // not a single digit
+        *text++ = tens + '0';
+    }
+    *text++ = value - tens * 10 + '0';
+    return text - start;
+}
+
+// days since 1970-01-01 of a date from 2000-01-01 to 2099-12-31, without loops:
+// years start with March, so the leap day is the last day of a year and
+// the days of the months before follow (153 * month + 2) / 5
+static uint16_t I2C_RTC_civilDays(uint8_t date, uint8_t month, uint8_t year) {
+    uint8_t y = year + 4 - (month < 3);                         // years since March 1996
+    uint8_t m = (month < 3) ? month + 9 : month - 3;            // months since March
+    uint16_t doy = (153 * m + 2) / 5 + date - 1;                // day of the year
+
+    return I2C_RTC_DAYS_1996 + 365U * y + y / 4 + doy;           // every 4th year is a leap year
+}
+
+uint8_t I2C_RTC_weekday(uint8_t date, uint8_t month, uint8_t year) {
+    if (month < 1 || month > 12) {  // no weekday without a month
+        return 1;
+    }
+    return (I2C_RTC_civilDays(date, month, year) + 3) % 7 + 1;  // 1970-01-01 was a Thursday
+}
+
+uint32_t I2C_RTC_toEpoch(const struct rtc_datetime *dt) {
+    uint32_t days = I2C_RTC_civilDays(dt->date, dt->month, dt->year);
+
+    return ((days * 24 + dt->hour) * 60 + dt->min) * 60 + dt->sec;
+}
+
+void I2C_RTC_fromEpoch(uint32_t epoch, struct rtc_datetime *dt) {
+    if (epoch < I2C_RTC_EPOCH_2000) {                           // limit to the range of the RTC
+        epoch = I2C_RTC_EPOCH_2000;
+    }
+    uint16_t days = epoch / 86400;                              // the only 32 bit division
+    uint32_t rest = epoch - days * 86400UL;
+    uint8_t hour = rest / 3600;
+    uint16_t seconds = rest - hour * 3600U;                     // seconds of the hour
+
+    dt->hour = hour;
+    dt->min = seconds / 60;
+    dt->sec = seconds % 60;
+    dt->weekday = (days + 3) % 7 + 1;
+
+    uint16_t z = days - I2C_RTC_DAYS_1996;                      // days since 1996-03-01
+    uint8_t y = ((uint32_t)z * 4 + 3) / 1461;                   // years since March 1996
+    uint16_t doy = z - (365U * y + y / 4);                       // day of the year
+    uint8_t m = (5 * doy + 2) / 153;                            // months since March
+
+    dt->date = doy - (153 * m + 2) / 5 + 1;
+    dt->month = (m < 10) ? m + 3 : m - 9;
+    dt->year = y - 4 + (dt->month < 3);
+}
+
+void I2C_RTC_add(struct rtc_datetime *dt, int32_t seconds) {
+    I2C_RTC_fromEpoch(I2C_RTC_toEpoch(dt) + seconds, dt);
+}
+
+int32_t I2C_RTC_diff(const struct rtc_datetime *a, const struct rtc_datetime *b) {
+    return I2C_RTC_toEpoch(a) - I2C_RTC_toEpoch(b);
+}
+
+void I2C_RTC_setTime(uint8_t sec, uint8_t min, uint8_t hour) {
+    if (sec > 59) {     // limit sec to 59
+        sec = 59;
+    }
+
+    if (min > 59) {     // limit min to 59
+        min = 59;
+    }
+
+    if (hour > 23) {    // limit hour to 23
+        hour = 23;
+    }
+
+    I2C_startWait(I2C_RTC_ADDRESS | I2C_RTC_WRITE);             // Start write to RTC (wait until BUS is free)
+    I2C_write(I2C_RTC_ADDRESS_SECONDS);                         // Begin from Seconds
+    I2C_write(I2C_RTC_bcd(sec));                                // Write seconds
+    I2C_write(I2C_RTC_bcd(min));                                // Write Minutes
+    I2C_write(I2C_RTC_bcd(hour));                               // Write hour + set time format
+    I2C_stop();                                                 // Stop I2C 
+    I2C_RTC_clockResync();                                      // software clock reads the new time
+}
+
+void I2C_RTC_setDate(uint8_t date, uint8_t month, uint8_t year) {
+    if (date > 31) {      // Limit date to 31
+        date = 31;
+    }
+
+    if (month > 12) {    // Limit month to 12
+        month = 12;
+    }
+
+    if (year > 99) {     // Limit year to 99
+        year = 99;
+    }
+
+    I2C_startWait(I2C_RTC_ADDRESS | I2C_RTC_WRITE);             // Start write to RTC (wait until BUS is free)
+    I2C_write(I2C_RTC_ADDRESS_DATE);                            // Begin from Date
+    I2C_write(I2C_RTC_bcd(date));                               // Write Date
+    I2C_write(I2C_RTC_bcd(month));                              // Write Month
+    I2C_write(I2C_RTC_bcd(year));                               // Write Year
+    I2C_stop();                                                 // Stop I2C 
+    I2C_RTC_clockResync();                                      // software clock reads the new time
+}
+
+void I2C_RTC_setDateTime(uint8_t sec, uint8_t min, uint8_t hour, uint8_t date, uint8_t month, uint8_t year) {
+    // same limits as setTime and setDate
+    sec = (sec > 59) ? 59 : sec;
+    min = (min > 59) ? 59 : min;
+    hour = (hour > 23) ? 23 : hour;
+    date = (date > 31) ? 31 : date;
+    month = (month > 12) ? 12 : month;
+    year = (year > 99) ? 99 : year;
+
+    // all 7 registers in one transaction, the time can not roll over into the old date
+    I2C_startWait(I2C_RTC_ADDRESS | I2C_RTC_WRITE);             // Start write to RTC (wait until BUS is free)
+    I2C_write(I2C_RTC_ADDRESS_SECONDS);                         // Begin from Seconds
+    I2C_write(I2C_RTC_bcd(sec));                                // Write seconds
+    I2C_write(I2C_RTC_bcd(min));                                // Write Minutes
+    I2C_write(I2C_RTC_bcd(hour));                               // Write hour + set time format
+    I2C_write(I2C_RTC_weekday(date, month, year));              // Write Weekday (1 = Monday)
+    I2C_write(I2C_RTC_bcd(date));                               // Write Date
+    I2C_write(I2C_RTC_bcd(month));                              // Write Month
+    I2C_write(I2C_RTC_bcd(year));                               // Write Year
+    I2C_stop();                                                 // Stop I2C 
+
+    // the registers hold a complete time again
+    uint8_t status = I2C_RTC_readRegister(I2C_RTC_ADDRESS_STATUS);
+    I2C_RTC_writeRegister(I2C_RTC_ADDRESS_STATUS, status & ~I2C_RTC_STATUS_OSF);
+    I2C_RTC_clockResync();                                      // software clock reads the new time
+}
+
+uint8_t I2C_RTC_timeValid(const struct rtc_datetime *dt) {
+    return !(dt->status & I2C_RTC_STATUS_OSF);
+}
+
+uint8_t I2C_RTC_checkTime(void) {
+    if (I2C_start(I2C_RTC_ADDRESS | I2C_RTC_WRITE)) {          // RTC does not answer
+        I2C_stop();
+        return 1;
+    }
+    I2C_write(I2C_RTC_ADDRESS_STATUS);                          // only the status
+    I2C_repStart(I2C_RTC_ADDRESS | I2C_RTC_READ);               // start read from RTC (repeated start)
+    uint8_t status = I2C_read(I2C_NAK);
+    I2C_stop();                                                 // stop I2C
+    return (status & I2C_RTC_STATUS_OSF) ? 1 : 0;
+}
+
+void I2C_RTC_readTime(char* time) {
+    I2C_startWait(I2C_RTC_ADDRESS | I2C_RTC_WRITE);             // Start write to RTC (wait until BUS is free)
+    // OSF costs 4 bytes: the pointer only wraps from 0x12 to 0x00, so aging and temperature are read, too
+    // (still less than a second transaction for the status alone)
+    I2C_write(I2C_RTC_ADDRESS_STATUS);                          // Begin from status, wraps to seconds
+    I2C_repStart(I2C_RTC_ADDRESS | I2C_RTC_READ);               // start read from RTC (repeated start)
+    uint8_t status = I2C_read(I2C_ACK);                         // save read value (status) + ack
+    for (uint8_t i = I2C_RTC_ADDRESS_AGING; i <= I2C_RTC_ADDRESS_TEMP_LSB; i++) {
+        I2C_read(I2C_ACK);                                      // skip aging and temperature
+    }
+    uint8_t sec = I2C_read(I2C_ACK);                            // save read value (sec) + ack
+    uint8_t min = I2C_read(I2C_ACK);                            // save read value (min) + ack
+    uint8_t hour = I2C_read(I2C_NAK);                           // save read value (hour) + nak
+    I2C_stop();                                                 // stop I2C
+
+    if (status & I2C_RTC_STATUS_OSF) {      // oscillator was stopped, the registers are not the time
+        for (uint8_t i = 0; i < 8; i++) {
+            *time++ = (i == 2 || i == 5) ? ':' : '-';
+        }
+        *time = '\0';                       // End Array
+        return;
+    }
+
+    // hh:mm:ss, straight into the array of the caller
+    *time++ = (hour>>4 & 0x03) + '0';       // ten's from hour
+    *time++ = (hour & 0x0F) + '0';          // unit place from hour
+    *time++ = ':';
+    *time++ = (min>>4 & 0x07) + '0';        // ten's from min
+    *time++ = (min & 0x0F) + '0';           // unit place from min
+    *time++ = ':';
+    *time++ = (sec>>4 & 0x07) + '0';        // ten's from sec
+    *time++ = (sec & 0x0F) + '0';           // unit place from sec
+    *time = '\0';                           // End Array
+}
+
+uint8_t I2C_RTC_read(struct rtc_datetime *dt) {
+    // the register pointer wraps from 0x12 to 0x00: status, aging, temperature, then the time
+    if (I2C_start(I2C_RTC_ADDRESS | I2C_RTC_WRITE)) {          // RTC does not answer
+        I2C_stop();
+        return 1;
+    }
+    I2C_write(I2C_RTC_ADDRESS_STATUS);                          // Begin from status
+    I2C_repStart(I2C_RTC_ADDRESS | I2C_RTC_READ);               // start read from RTC (repeated start)
+    dt->status = I2C_read(I2C_ACK);                             // status
+    for (uint8_t i = I2C_RTC_ADDRESS_AGING; i <= I2C_RTC_ADDRESS_TEMP_LSB; i++) {
+        I2C_read(I2C_ACK);                                      // skip aging and temperature
+    }
+    dt->sec = I2C_RTC_bin(I2C_read(I2C_ACK) & 0x7F);
+    dt->min = I2C_RTC_bin(I2C_read(I2C_ACK) & 0x7F);
+    dt->hour = I2C_RTC_bin(I2C_read(I2C_ACK) & 0x3F);          // 24h format
+    dt->weekday = I2C_read(I2C_ACK) & 0x07;
+    dt->date = I2C_RTC_bin(I2C_read(I2C_ACK) & 0x3F);
+    dt->month = I2C_RTC_bin(I2C_read(I2C_ACK) & 0x1F);         // without century bit
+    dt->year = I2C_RTC_bin(I2C_read(I2C_NAK));
+    I2C_stop();                                                 // stop I2C
+    return 0;
+}
+
+char *I2C_RTC_format(const uint8_t *format, const struct rtc_datetime *dt, char *text) {
+    uint8_t op;
+
+    while ((op = pgm_read_byte(format++)) != I2C_RTC_FMT_END) {
+        text += I2C_RTC_field(op, dt, text);
+    }
+    *text = '\0';
+    return text;
+}
+
+void I2C_RTC_formatPut(const uint8_t *format, const struct rtc_datetime *dt, void (*put)(uint8_t)) {
+    uint8_t op;
+    char chars[4];
+
+    while ((op = pgm_read_byte(format++)) != I2C_RTC_FMT_END) {
+        uint8_t count = I2C_RTC_field(op, dt, chars);
+        for (uint8_t i = 0; i < count; i++) {
+            put(chars[i]);
+        }
+    }
+}
+
+char *I2C_RTC_formatTime(const struct rtc_datetime *dt, char *text) {
+    return I2C_RTC_format(I2C_RTC_fmtTime, dt, text);
+}
+
+char *I2C_RTC_formatDate(const struct rtc_datetime *dt, char *text) {
+    return I2C_RTC_format(I2C_RTC_fmtDate, dt, text);
+}
+
+void I2C_RTC_setSQW(uint8_t clk_speed) {
+    uint8_t control = I2C_RTC_readRegister(I2C_RTC_ADDRESS_ControlRegister);
+
+    control &= ~(I2C_RTC_CONTROL_RS | I2C_RTC_CONTROL_INTCN);  // square wave on the pin
+    control |= (clk_speed << 3) & I2C_RTC_CONTROL_RS;          // clock speed
+    I2C_RTC_writeRegister(I2C_RTC_ADDRESS_ControlRegister, control);
+}
+
+uint8_t I2C_RTC_readRegister(uint8_t reg) {
+    I2C_startWait(I2C_RTC_ADDRESS | I2C_RTC_WRITE);             // Start write to RTC (wait until BUS is free)
+    I2C_write(reg);                                             // Begin from register
+    I2C_repStart(I2C_RTC_ADDRESS | I2C_RTC_READ);               // start read from RTC (repeated start)
+    uint8_t value = I2C_read(I2C_NAK);                          // save read value + nak
+    I2C_stop();                                                 // stop I2C
+    return value;
+}
+
+void I2C_RTC_writeRegister(uint8_t reg, uint8_t value) {
+    I2C_startWait(I2C_RTC_ADDRESS | I2C_RTC_WRITE);             // Start write to RTC (wait until BUS is free)
+    I2C_write(reg);                                             // Begin from register
+    I2C_write(value);                                           // Write value
+    I2C_stop();                                                 // Stop I2C
+}
+
+// clear the flags and enable the interrupts of alarms on the INT/SQW pin
+static void I2C_RTC_enableAlarms(uint8_t alarms) {
+    uint8_t status = I2C_RTC_readRegister(I2C_RTC_ADDRESS_STATUS);
+    I2C_RTC_writeRegister(I2C_RTC_ADDRESS_STATUS, status & ~alarms);
+
+    uint8_t control = I2C_RTC_readRegister(I2C_RTC_ADDRESS_ControlRegister);
+    I2C_RTC_writeRegister(I2C_RTC_ADDRESS_ControlRegister, control | I2C_RTC_CONTROL_INTCN | alarms);
+}
+
+// day/date register of an alarm: DY/DT bit, date or weekday and mask bit M4
+static uint8_t I2C_RTC_alarmDay(uint8_t mode, uint8_t day) {
+    if (mode & I2C_RTC_ALARM_WEEKDAY) {
+        day = (day < 1 || day > 7) ? 1 : day;
+    } else {
+        day = (day < 1 || day > 31) ? 1 : day;
+    }
+    return (mode & I2C_RTC_ALARM_WEEKDAY) | ((mode & 0x08) << 4) | I2C_RTC_bcd(day);
+}
+
+void I2C_RTC_setAlarm1(uint8_t mode, uint8_t day, uint8_t hour, uint8_t min, uint8_t sec) {
+    sec = (sec > 59) ? 59 : sec;
+    min = (min > 59) ? 59 : min;
+    hour = (hour > 23) ? 23 : hour;
+
+    I2C_startWait(I2C_RTC_ADDRESS | I2C_RTC_WRITE);             // Start write to RTC (wait until BUS is free)
+    I2C_write(I2C_RTC_ADDRESS_ALARM1);                          // Begin from alarm 1 seconds
+    I2C_write(((mode & 0x01) << 7) | I2C_RTC_bcd(sec));         // Write seconds + A1M1
+    I2C_write(((mode & 0x02) << 6) | I2C_RTC_bcd(min));         // Write minutes + A1M2
+    I2C_write(((mode & 0x04) << 5) | I2C_RTC_bcd(hour));        // Write hour (24h) + A1M3
+    I2C_write(I2C_RTC_alarmDay(mode, day));                     // Write day + A1M4 + DY/DT
+    I2C_stop();                                                 // Stop I2C
+
+    I2C_RTC_enableAlarms(I2C_RTC_ALARM1);
+}
+
+void I2C_RTC_setAlarm2(uint8_t mode, uint8_t day, uint8_t hour, uint8_t min) {
+    min = (min > 59) ? 59 : min;
+    hour = (hour > 23) ? 23 : hour;
+
+    I2C_startWait(I2C_RTC_ADDRESS | I2C_RTC_WRITE);             // Start write to RTC (wait until BUS is free)
+    I2C_write(I2C_RTC_ADDRESS_ALARM2);                          // Begin from alarm 2 minutes
+    I2C_write(((mode & 0x02) << 6) | I2C_RTC_bcd(min));         // Write minutes + A2M2
+    I2C_write(((mode & 0x04) << 5) | I2C_RTC_bcd(hour));        // Write hour (24h) + A2M3
+    I2C_write(I2C_RTC_alarmDay(mode, day));                     // Write day + A2M4 + DY/DT
+    I2C_stop();                                                 // Stop I2C
+
+    I2C_RTC_enableAlarms(I2C_RTC_ALARM2);
+}
+
+void I2C_RTC_disableAlarms(uint8_t alarms) {
+    uint8_t control = I2C_RTC_readRegister(I2C_RTC_ADDRESS_ControlRegister);
+    I2C_RTC_writeRegister(I2C_RTC_ADDRESS_ControlRegister, control & ~(alarms & (I2C_RTC_ALARM1 | I2C_RTC_ALARM2)));
+}
+
+uint8_t I2C_RTC_clearAlarms(void) {
+    uint8_t status = I2C_RTC_readRegister(I2C_RTC_ADDRESS_STATUS);
+    uint8_t alarms = status & (I2C_RTC_STATUS_A1F | I2C_RTC_STATUS_A2F);
+
+    if (alarms) {
+        I2C_RTC_writeRegister(I2C_RTC_ADDRESS_STATUS, status & ~alarms);
+    }
+    return alarms;
+}
+
+void I2C_RTC_alarmWakeup(void) {
+    EIMSK &= ~(1 << INT0);                      // low level would call the interrupt again and again
+    alarm_wakeup = 1;
+}
+
+uint8_t I2C_RTC_sleepUntilAlarm(void) {
+    I2C_RTC_INT_DDR &= ~(1 << I2C_RTC_INT_BIT);                 // input
+    I2C_RTC_INT_PORT |= (1 << I2C_RTC_INT_BIT);                 // pull-up for the open drain output
+    EICRA &= ~((1 << ISC01) | (1 << ISC00));                    // low level, the only one waking up from power-down
+
+    set_sleep_mode(SLEEP_MODE_PWR_DOWN);
+    alarm_wakeup = 0;
+    while (!alarm_wakeup) {
+        cli();
+        if (!(I2C_RTC_INT_PIN & (1 << I2C_RTC_INT_BIT))) {     // alarm is already there
+            sei();
+            break;
+        }
+        EIMSK |= (1 << INT0);                                   // enable interrupt
+        sleep_enable();
+        sei();                                                  // sleep follows before any interrupt
+        sleep_cpu();
+        sleep_disable();
+    }
+    EIMSK &= ~(1 << INT0);
+
+    return I2C_RTC_clearAlarms();
+}
+
+uint8_t I2C_RTC_monthDays(uint8_t month, uint8_t year) {
+    if (month < 1 || month > 12) {  // garbage after a power loss, stay inside the table
+        return 31;
+    }
+    if (month == 2 && !(year & 0x03)) {
+        return 29;
+    }
+    return pgm_read_byte(&I2C_RTC_monthLength[month - 1]);
+}
+
+void I2C_RTC_clockInit(uint8_t resyncMinutes) {
+    struct rtc_datetime now = {0};
+    uint8_t error;
+
+    error = I2C_RTC_read(&now);                 // seed from one burst
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        clock_now = now;
+        clock_minutes = 0;
+        clock_resyncMinutes = resyncMinutes;
+        clock_resync = error;                   // RTC does not answer, I2C_RTC_clockTask retries
+        clock_drift = 0;
+    }
+}
+
+uint8_t I2C_RTC_clockTick(void) {
+    if (++clock_now.sec < 60) {
+        return 0;
+    }
+    clock_now.sec = 0;
+    if (clock_resyncMinutes && ++clock_minutes >= clock_resyncMinutes) {
+        clock_minutes = 0;
+        clock_resync = 1;                       // I2C_RTC_clockTask reads the RTC
+    }
+    if (++clock_now.min >= 60) {
+        clock_now.min = 0;
+        if (++clock_now.hour >= 24) {
+            clock_now.hour = 0;
+            clock_now.weekday = (clock_now.weekday % 7) + 1;
+            if (++clock_now.date > I2C_RTC_monthDays(clock_now.month, clock_now.year)) {
+                clock_now.date = 1;
+                if (++clock_now.month > 12) {
+                    clock_now.month = 1;
+                    clock_now.year = (clock_now.year + 1) % 100;
+                }
+            }
+        }
+    }
+    return 1;
+}
+
+void I2C_RTC_clockGet(struct rtc_datetime *dt) {
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        *dt = clock_now;
+    }
+}
+
+void I2C_RTC_clockResync(void) {
+    clock_resync = 1;
+}
+
+uint8_t I2C_RTC_clockTask(void) {
+    struct rtc_datetime now;
+
+    if (!clock_resync) {
+        return 0;                               // bus stays quiet
+    }
+    if (I2C_RTC_read(&now)) {
+        return 0;                               // RTC does not answer, try again with the next call
+    }
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        clock_drift = I2C_RTC_diff(&clock_now, &now);
+        clock_now = now;
+        clock_minutes = 0;
+        clock_resync = 0;
+    }
+    return 1;
+}
+
+int32_t I2C_RTC_clockDrift(void) {
+    int32_t drift;
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        drift = clock_drift;
+    }
+    return drift;
+}
+
+// wait until a bit of a register is cleared, 1 if it is still set after I2C_RTC_CONVERT_POLLS
+static uint8_t I2C_RTC_waitCleared(uint8_t reg, uint8_t bit) {
+    for (uint8_t i = 0; i < I2C_RTC_CONVERT_POLLS; i++) {
+        if (!(I2C_RTC_readRegister(reg) & bit)) {
+            return 0;
+        }
+        _delay_ms(1);
+    }
+    return 1;
+}
+
+int16_t I2C_RTC_readTemperature(uint8_t convert) {
+    if (convert) {
+        if (I2C_RTC_waitCleared(I2C_RTC_ADDRESS_STATUS, I2C_RTC_STATUS_BSY)) {
+            return I2C_RTC_TEMP_ERROR;          // automatic conversion does not end
+        }
+        uint8_t control = I2C_RTC_readRegister(I2C_RTC_ADDRESS_ControlRegister);
+        I2C_RTC_writeRegister(I2C_RTC_ADDRESS_ControlRegister, control | I2C_RTC_CONTROL_CONV);
+        if (I2C_RTC_waitCleared(I2C_RTC_ADDRESS_ControlRegister, I2C_RTC_CONTROL_CONV)) {
+            return I2C_RTC_TEMP_ERROR;          // CONV is cleared when the conversion is done
+        }
+    }
+
+    I2C_startWait(I2C_RTC_ADDRESS | I2C_RTC_WRITE);             // Start write to RTC (wait until BUS is free)
+    I2C_write(I2C_RTC_ADDRESS_TEMP_MSB);                        // Begin from temperature
+    I2C_repStart(I2C_RTC_ADDRESS | I2C_RTC_READ);               // start read from RTC (repeated start)
+    int8_t msb = I2C_read(I2C_ACK);                             // integer part (two's complement)
+    uint8_t lsb = I2C_read(I2C_NAK);                            // fraction in bit 7 and 6
+    I2C_stop();                                                 // stop I2C
+
+    return msb * 4 + (lsb >> 6);
+}
+
+int8_t I2C_RTC_readAging(void) {
+    return I2C_RTC_readRegister(I2C_RTC_ADDRESS_AGING);
+}
+
+void I2C_RTC_writeAging(int8_t offset) {
+    I2C_RTC_writeRegister(I2C_RTC_ADDRESS_AGING, offset);
+    I2C_RTC_readTemperature(1);                 // the offset is used with the next conversion
+}
+
+// read the seconds register without waiting for the bus, 0xFF if the RTC does not answer
+static uint8_t I2C_RTC_readSeconds(void) {
+    if (I2C_start(I2C_RTC_ADDRESS | I2C_RTC_WRITE)) {          // RTC does not answer
+        I2C_stop();
+        return 0xFF;
+    }
+    I2C_write(I2C_RTC_ADDRESS_SECONDS);                         // only the seconds
+    I2C_repStart(I2C_RTC_ADDRESS | I2C_RTC_READ);               // start read from RTC (repeated start)
+    uint8_t sec = I2C_read(I2C_NAK);
+    I2C_stop();
+    return sec;
+}
+
+uint32_t I2C_RTC_waitSecond(void) {
+    struct rtc_datetime now;
+    uint8_t sec = I2C_RTC_readSeconds();
+
+    if (sec == 0xFF) {
+        return 0;                               // RTC does not answer
+    }
+    for (uint16_t i = 0; i < I2C_RTC_SECOND_POLLS; i++) {
+        uint8_t next = I2C_RTC_readSeconds();
+        if (next == 0xFF) {
+            return 0;                           // RTC does not answer
+        }
+        if (next != sec) {
+            if (I2C_RTC_read(&now)) {
+                return 0;
+            }
+            return I2C_RTC_toEpoch(&now);
+        }
+        _delay_ms(1);                           // short polls for a small error
+    }
+    return 0;                                   // seconds do not count, the oscillator stopped
+}
+
+uint8_t I2C_RTC_calibrateStart(uint32_t (*referenceMs)(void)) {
+    calib_rtc = I2C_RTC_waitSecond();           // 0 marks the calibration as invalid
+    calib_ref = referenceMs();
+    return !calib_rtc;
+}
+
+int16_t I2C_RTC_calibrateFinish(uint32_t (*referenceMs)(void)) {
+    uint32_t rtc = I2C_RTC_waitSecond();
+    uint32_t ref = referenceMs() - calib_ref;                   // elapsed reference ms
+    int32_t error = (int32_t)((rtc - calib_rtc) * 1000UL - ref);    // RTC ahead in ms
+
+    if (!rtc || !calib_rtc) {
+        return 0;                               // RTC did not answer, keep the aging offset
+    }
+    if (ref < I2C_RTC_CALIBRATE_MIN) {
+        return 0;                               // too short for a useful offset
+    }
+    error = (error > 200000L) ? 200000L : (error < -200000L) ? -200000L : error;
+    int32_t drift = error * 10000L / (int32_t)(ref / 1000);     // 0.1ppm, positive: RTC is fast
+
+    // one step of the aging offset is about 0.1ppm, a higher offset slows the RTC down
+    int32_t offset = I2C_RTC_readAging() + drift;
+    offset = (offset > 127) ? 127 : (offset < -128) ? -128 : offset;
+    I2C_RTC_writeAging(offset);
+    return (drift > 32767) ? 32767 : (drift < -32768) ? -32768 : drift;
+}
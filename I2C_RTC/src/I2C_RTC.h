@@ -0,0 +1,495 @@
+/**
+ * @file I2C_RTC.h
+ *
+ * @author ClefaMedia, Deniel Skopek & Manuel Rathbauer
+ *
+ * @version 1.0
+ *
+ * @copyright
+ * Copyright (C) ClefaMedia 2021. 
+ * All Rights MIT Licensed.
+ *
+ * @brief This library was created to connect a Real Time Clock in 24h format via I2C
+ * 
+ * The I2C library from clefa is used for the I2C-connection.
+ */
+
+#ifndef _I2C_RTC_H                      // Prevents duplicate
+#define _I2C_RTC_H   1                  // forward declarations
+
+#include <avr/io.h>                     // Requires AVR Input/Output
+#include <inttypes.h>                   // Requires Inttypes
+#include <stddef.h>                     // Requires offsetof
+#include <avr/pgmspace.h>               // Requires PROGMEM
+
+#define I2C_RTC_ADDRESS 0xD0            // full 8-bit address of the I2C-Modul
+
+#define I2C_RTC_WRITE   0x00            // write bit to combine with the address
+#define I2C_RTC_READ    0x01            // read bit to combine with the address
+
+#define I2C_RTC_ADDRESS_SECONDS 0x00    // RTC address for the second register
+#define I2C_RTC_ADDRESS_MINUTES 0x01    // RTC address for the minute register
+#define I2C_RTC_ADDRESS_HOUR    0x02    // RTC address for the hour register
+#define I2C_RTC_ADDRESS_DAY     0x03    // RTC address for the weekday register
+#define I2C_RTC_ADDRESS_DATE    0x04    // RTC address for the date register
+#define I2C_RTC_ADDRESS_MONTH   0x05    // RTC address for the month register
+#define I2C_RTC_ADDRESS_YEAR    0x06    // RTC address for the year register
+#define I2C_RTC_ADDRESS_ALARM1  0x07    // RTC address for the first alarm 1 register (seconds)
+#define I2C_RTC_ADDRESS_ALARM2  0x0B    // RTC address for the first alarm 2 register (minutes)
+#define I2C_RTC_ADDRESS_ControlRegister 0x0E    // RTC address for the control register
+#define I2C_RTC_ADDRESS_STATUS  0x0F    // RTC address for the status register
+#define I2C_RTC_ADDRESS_AGING   0x10    // RTC address for the aging offset register
+#define I2C_RTC_ADDRESS_TEMP_MSB 0x11   // RTC address for the temperature register (integer)
+#define I2C_RTC_ADDRESS_TEMP_LSB 0x12   // RTC address for the temperature register (fraction)
+
+// bits of the control register
+#define I2C_RTC_CONTROL_EOSC    0x80    // oscillator stopped on battery
+#define I2C_RTC_CONTROL_BBSQW   0x40    // square wave on battery
+#define I2C_RTC_CONTROL_CONV    0x20    // start temperature conversion
+#define I2C_RTC_CONTROL_RS      0x18    // rate select of the square wave
+#define I2C_RTC_CONTROL_INTCN   0x04    // INT/SQW pin is used for the alarms
+#define I2C_RTC_CONTROL_A2IE    0x02    // alarm 2 interrupt enabled
+#define I2C_RTC_CONTROL_A1IE    0x01    // alarm 1 interrupt enabled
+
+// bits of the status register
+#define I2C_RTC_STATUS_OSF      0x80    // oscillator was stopped
+#define I2C_RTC_STATUS_EN32KHZ  0x08    // 32kHz output enabled
+#define I2C_RTC_STATUS_BSY      0x04    // temperature conversion running
+#define I2C_RTC_STATUS_A2F      0x02    // alarm 2 matched
+#define I2C_RTC_STATUS_A1F      0x01    // alarm 1 matched
+
+// result of I2C_RTC_readTemperature if the conversion does not end (below -128 degree)
+#define I2C_RTC_TEMP_ERROR      (-32768)
+
+// shortest calibration in ms (1 hour), 1ms is about 0.3ppm then
+#define I2C_RTC_CALIBRATE_MIN   3600000UL
+
+// alarms (bitmask, same bits as the enable and flag bits)
+#define I2C_RTC_ALARM1          0x01
+#define I2C_RTC_ALARM2          0x02
+
+// match modes of the alarms (mask bits M1 - M4 and DY/DT)
+#define I2C_RTC_ALARM_EVERY     0x0F    // alarm 1: every second, alarm 2: every minute
+#define I2C_RTC_ALARM_SEC       0x0E    // alarm 1: seconds match, alarm 2: every minute
+#define I2C_RTC_ALARM_MIN       0x0C    // minutes (and seconds) match
+#define I2C_RTC_ALARM_HOUR      0x08    // hours, minutes (and seconds) match
+#define I2C_RTC_ALARM_DATE      0x00    // date, hours, minutes (and seconds) match
+#define I2C_RTC_ALARM_WEEKDAY   0x40    // weekday, hours, minutes (and seconds) match
+
+// INT/SQW input of the alarms (INT0)
+#define I2C_RTC_INT_DDR         DDRD
+#define I2C_RTC_INT_PORT        PORTD
+#define I2C_RTC_INT_PIN         PIND
+#define I2C_RTC_INT_BIT         PD2
+
+// seconds from 1970-01-01 (Unix epoch) to 2000-01-01, the first second of the RTC
+#define I2C_RTC_EPOCH_2000  946684800UL
+
+/** @brief binary date and time of the RTC */
+struct rtc_datetime
+{
+    uint8_t sec;                        // seconds 0 - 59
+    uint8_t min;                        // minutes 0 - 59
+    uint8_t hour;                       // hours 0 - 23
+    uint8_t weekday;                    // 1 (Monday) - 7 (Sunday)
+    uint8_t date;                       // day 1 - 31
+    uint8_t month;                      // month 1 - 12
+    uint8_t year;                       // years 0 - 99 (2000 - 2099)
+    uint8_t status;                     // status register of the RTC
+};
+
+/** ===================================================
+ * @brief function to initialize the RTC module
+ * 
+ * Need to be called only once
+ * 
+ * All time and date registers incl. the weekday are written
+ * in one transaction, so the time can not roll over between them.
+ * The oscillator stop flag is cleared afterwards, the time is valid again
+ * (I2C_RTC_setTime and I2C_RTC_setDate alone do not clear it).
+ * 
+ * The I2C-Bus must be initialized in the main-file (f.e. 80kHz)
+ * with this code: "I2C_init(SCL_CLK)"
+ * 
+ * @param sec seconds from 0 to 59
+ * @param min minutes from 0 to 59
+ * @param hour hours from 0 to 24
+ * @param date day from 0 to (27-31)
+ * @param month month from 0 to 12
+ * @param year years from 0 to 99
+ */
+void I2C_RTC_setDateTime(uint8_t sec, uint8_t min, uint8_t hour, uint8_t date, uint8_t month, uint8_t year);
+
+/** ===================================================
+ * @brief function to check the time of a burst read (no I2C communication):
+ * the oscillator stop flag is set after a power loss without battery,
+ * until the time is set with I2C_RTC_setDateTime
+ * 
+ * @param dt date and time from I2C_RTC_read or I2C_RTC_clockGet
+ * @return 1 time is valid, 0 the registers are not the time
+ */
+uint8_t I2C_RTC_timeValid(const struct rtc_datetime *dt);
+
+/** ===================================================
+ * @brief function to check the time at the start of the program,
+ * reads only the status register
+ * 
+ * @return 0 time is valid, 1 oscillator was stopped or the RTC does not answer
+ */
+uint8_t I2C_RTC_checkTime(void);
+
+/** ===================================================
+ * @brief function to calculate the weekday of a date
+ * 
+ * @param date day from 1 to (28-31)
+ * @param month month from 1 to 12
+ * @param year years from 0 to 99 (2000 - 2099)
+ * @return weekday from 1 (Monday) to 7 (Sunday)
+ */
+uint8_t I2C_RTC_weekday(uint8_t date, uint8_t month, uint8_t year);
+
+/** ===================================================
+ * @brief function to get the days of a month
+ * (every 4th year is a leap year from 2000 to 2099)
+ * 
+ * @param month month from 1 to 12
+ * @param year years from 0 to 99
+ * @return days 28 - 31 (31 for a month outside 1 - 12)
+ */
+uint8_t I2C_RTC_monthDays(uint8_t month, uint8_t year);
+
+/** ===================================================
+ * @brief function to convert date and time to seconds
+ * since 1970-01-01 00:00:00 (Unix epoch) without loops
+ * 
+ * @param dt date and time from 2000 to 2099
+ * @return epoch seconds
+ */
+uint32_t I2C_RTC_toEpoch(const struct rtc_datetime *dt);
+
+/** ===================================================
+ * @brief function to convert seconds since 1970-01-01 00:00:00
+ * to date, time and weekday without loops.
+ * The status is not changed.
+ * 
+ * @param epoch seconds from I2C_RTC_EPOCH_2000 until 2099-12-31 23:59:59
+ * @param dt date and time
+ */
+void I2C_RTC_fromEpoch(uint32_t epoch, struct rtc_datetime *dt);
+
+/** ===================================================
+ * @brief function to add seconds to date and time
+ * 
+ * @param dt date and time, changed
+ * @param seconds seconds to add (negative: subtract)
+ */
+void I2C_RTC_add(struct rtc_datetime *dt, int32_t seconds);
+
+/** ===================================================
+ * @brief function to get the seconds between two dates
+ * 
+ * @param a date and time
+ * @param b date and time
+ * @return a - b in seconds
+ */
+int32_t I2C_RTC_diff(const struct rtc_datetime *a, const struct rtc_datetime *b);
+
+/** ===================================================
+ * @brief function to set the time and timeformate on the RTC
+ * 
+ * @param sec seconds from 0 to 59
+ * @param min minutes from 0 to 59
+ * @param hour hours from 0 to 24
+ */
+void I2C_RTC_setTime(uint8_t sec, uint8_t min, uint8_t hour);
+
+/** ===================================================
+ * @brief function to set the date on the RTC
+ * 
+ * @param date day from 0 to (27-31)
+ * @param month month from 0 to 12
+ * @param year years from 0 to 99
+ */
+void I2C_RTC_setDate(uint8_t date, uint8_t month, uint8_t year);
+
+
+/** ===================================================
+ * @brief function to get the current time
+ * ("--:--:--" if the oscillator was stopped).
+ * Reads 7 registers from 0x0F over 0x12 to 0x02: status, aging and
+ * temperature are 4 bytes more than the time, as the pointer only wraps from 0x12.
+ * 
+ * @param time char pointer - points to array where the time will be saved (optimal format: hh:mm:ss\0, required length: 9)
+ */
+void I2C_RTC_readTime(char *time);
+
+/** ===================================================
+ * @brief function to read date, time and the status
+ * in one transaction (11 registers from 0x0F over 0x12 to 0x06),
+ * check the time with I2C_RTC_timeValid
+ * 
+ * @param dt date and time in binary
+ * @return 0 on success, 1 if the RTC does not answer
+ */
+uint8_t I2C_RTC_read(struct rtc_datetime *dt);
+
+// opcodes of a format: chars below 0x80 are copied, fields are 0x80 | offset in struct rtc_datetime
+#define I2C_RTC_FMT_END     0x00                                            // end of the format
+#define I2C_RTC_FMT_SEC     (0x80 | offsetof(struct rtc_datetime, sec))     // seconds "ss"
+#define I2C_RTC_FMT_MIN     (0x80 | offsetof(struct rtc_datetime, min))     // minutes "mm"
+#define I2C_RTC_FMT_HOUR    (0x80 | offsetof(struct rtc_datetime, hour))    // hours "hh"
+#define I2C_RTC_FMT_DATE    (0x80 | offsetof(struct rtc_datetime, date))    // day "dd"
+#define I2C_RTC_FMT_MONTH   (0x80 | offsetof(struct rtc_datetime, month))   // month "mm"
+#define I2C_RTC_FMT_YEAR    (0x80 | offsetof(struct rtc_datetime, year))    // year "yy"
+#define I2C_RTC_FMT_YEAR4   (0x90 | offsetof(struct rtc_datetime, year))    // year "20yy"
+#define I2C_RTC_FMT_WEEKDAY (0xA0 | offsetof(struct rtc_datetime, weekday)) // weekday "1" - "7"
+
+/** @brief macro to define a format in PROGMEM, f.e.
+ * I2C_RTC_FORMAT(myFormat, I2C_RTC_FMT_HOUR, 'h', I2C_RTC_FMT_MIN);
+ */
+#define I2C_RTC_FORMAT(name, ...) const uint8_t name[] PROGMEM = {__VA_ARGS__, I2C_RTC_FMT_END}
+
+/** @brief formats: "hh:mm:ss", "hh:mm", "dd.mm.yy", "dd.mm.", "YYYY-MM-DD", "YYYY-MM-DDThh:mm:ssZ" */
+extern const uint8_t I2C_RTC_fmtTime[];
+extern const uint8_t I2C_RTC_fmtHHMM[];
+extern const uint8_t I2C_RTC_fmtDate[];
+extern const uint8_t I2C_RTC_fmtDDMM[];
+extern const uint8_t I2C_RTC_fmtYMD[];
+extern const uint8_t I2C_RTC_fmtISO8601[];
+
+/** ===================================================
+ * @brief function to write date and time as text
+ * with a format from I2C_RTC_FORMAT (no parsing)
+ * 
+ * @param format opcodes in PROGMEM, f.e. I2C_RTC_fmtISO8601
+ * @param dt date and time
+ * @param text array for the text and '\0'
+ * @return pointer to the terminating '\0' to append more text
+ */
+char *I2C_RTC_format(const uint8_t *format, const struct rtc_datetime *dt, char *text);
+
+/** ===================================================
+ * @brief function to send date and time char by char
+ * with a format from I2C_RTC_FORMAT, f.e. straight to the LCD:
+ * I2C_startWait(I2C_LCD_ADDRESS & ~I2C_WRITE);
+ * I2C_LCD_setCursorWOI2C(1, 1);
+ * I2C_RTC_formatPut(I2C_RTC_fmtHHMM, &dt, I2C_LCD_write);
+ * I2C_stop();
+ * 
+ * @param format opcodes in PROGMEM
+ * @param dt date and time
+ * @param put function called with every char
+ */
+void I2C_RTC_formatPut(const uint8_t *format, const struct rtc_datetime *dt, void (*put)(uint8_t));
+
+/** ===================================================
+ * @brief function to write the time as text
+ * 
+ * @param dt date and time
+ * @param text array for "hh:mm:ss\0", required length: 9
+ * @return pointer to the terminating '\0' to append more text
+ */
+char *I2C_RTC_formatTime(const struct rtc_datetime *dt, char *text);
+
+/** ===================================================
+ * @brief function to write the date as text
+ * 
+ * @param dt date and time
+ * @param text array for "dd.mm.yy\0", required length: 9
+ * @return pointer to the terminating '\0' to append more text
+ */
+char *I2C_RTC_formatDate(const struct rtc_datetime *dt, char *text);
+
+/** ===================================================
+ * @brief function to enable square wave output on sqw - pin.
+ * Only the rate and INTCN are changed in the control register,
+ * the alarms can not use the pin while the square wave is on.
+ * 
+ * @param clk_speed 0x00: 1Hz, 0x01: 1.024kHz, 0x02: 4.096kHz, 0x03: 8.192kHz
+ */
+void I2C_RTC_setSQW(uint8_t clk_speed);
+
+/** ===================================================
+ * @brief function to read a register of the RTC
+ * 
+ * @param reg register address
+ * @return value of the register
+ */
+uint8_t I2C_RTC_readRegister(uint8_t reg);
+
+/** ===================================================
+ * @brief function to write a register of the RTC
+ * 
+ * @param reg register address
+ * @param value new value
+ */
+void I2C_RTC_writeRegister(uint8_t reg, uint8_t value);
+
+/** ===================================================
+ * @brief function to set alarm 1 and route it to the INT/SQW pin
+ * (the square wave is switched off). The old flag is cleared.
+ * 
+ * @param mode I2C_RTC_ALARM_EVERY, _SEC, _MIN, _HOUR, _DATE or _WEEKDAY
+ * @param day date 1 - 31 or weekday 1 - 7 (_DATE / _WEEKDAY)
+ * @param hour hours from 0 to 23
+ * @param min minutes from 0 to 59
+ * @param sec seconds from 0 to 59
+ */
+void I2C_RTC_setAlarm1(uint8_t mode, uint8_t day, uint8_t hour, uint8_t min, uint8_t sec);
+
+/** ===================================================
+ * @brief function to set alarm 2 (always at second 00)
+ * and route it to the INT/SQW pin (the square wave is switched off).
+ * The old flag is cleared.
+ * 
+ * @param mode I2C_RTC_ALARM_EVERY, _MIN, _HOUR, _DATE or _WEEKDAY
+ * @param day date 1 - 31 or weekday 1 - 7 (_DATE / _WEEKDAY)
+ * @param hour hours from 0 to 23
+ * @param min minutes from 0 to 59
+ */
+void I2C_RTC_setAlarm2(uint8_t mode, uint8_t day, uint8_t hour, uint8_t min);
+
+/** ===================================================
+ * @brief function to disable alarms
+ * 
+ * @param alarms I2C_RTC_ALARM1 | I2C_RTC_ALARM2
+ */
+void I2C_RTC_disableAlarms(uint8_t alarms);
+
+/** ===================================================
+ * @brief function to clear the flags of the alarms,
+ * the INT/SQW pin goes high again
+ * 
+ * @return alarms which matched (I2C_RTC_ALARM1 | I2C_RTC_ALARM2)
+ */
+uint8_t I2C_RTC_clearAlarms(void);
+
+/** ===================================================
+ * @brief function to call from the INT0 interrupt of the application:
+ * ISR(INT0_vect) { I2C_RTC_alarmWakeup(); }
+ * The interrupt is disabled until the next I2C_RTC_sleepUntilAlarm,
+ * no I2C communication.
+ */
+void I2C_RTC_alarmWakeup(void);
+
+/** ===================================================
+ * @brief function to wait in power-down until the INT/SQW pin
+ * of the RTC goes low (low level interrupt of INT0) and
+ * clear the flags of the alarms afterwards.
+ * The INT0 interrupt must call I2C_RTC_alarmWakeup.
+ * 
+ * @return alarms which matched (I2C_RTC_ALARM1 | I2C_RTC_ALARM2)
+ */
+uint8_t I2C_RTC_sleepUntilAlarm(void);
+
+/** ===================================================
+ * @brief function to start the software clock
+ * with one burst read of the RTC.
+ * The clock is advanced by I2C_RTC_clockTick and
+ * read from RAM by I2C_RTC_clockGet, the RTC is only
+ * read again by I2C_RTC_clockTask when a resync is due.
+ * If the RTC does not answer, the clock starts from zero
+ * and the next I2C_RTC_clockTask retries the read.
+ * 
+ * @param resyncMinutes minutes between two resyncs, 0: only with I2C_RTC_clockResync
+ */
+void I2C_RTC_clockInit(uint8_t resyncMinutes);
+
+/** ===================================================
+ * @brief function to advance the software clock by one second.
+ * Has to be called from the interrupt of the 1Hz square wave
+ * (falling edge) or a 1Hz timer, no I2C communication.
+ * 
+ * @return 1 if a new minute started, else 0
+ */
+uint8_t I2C_RTC_clockTick(void);
+
+/** ===================================================
+ * @brief function to read the software clock (copy from RAM)
+ * 
+ * @param dt date and time
+ */
+void I2C_RTC_clockGet(struct rtc_datetime *dt);
+
+/** ===================================================
+ * @brief function to request a resync with the next I2C_RTC_clockTask,
+ * f.e. after the RTC was changed without this library
+ * (I2C_RTC_setDateTime, _setTime and _setDate request it)
+ */
+void I2C_RTC_clockResync(void);
+
+/** ===================================================
+ * @brief function to resync the software clock with the RTC when due.
+ * Has to be called in the main loop,
+ * returns at once if no resync is due.
+ * 
+ * @return 1 if the clock was resynced, else 0
+ */
+uint8_t I2C_RTC_clockTask(void);
+
+/** ===================================================
+ * @brief function to get the drift measured with the last resync
+ * 
+ * @return software clock - RTC in seconds (positive: software clock was ahead)
+ */
+int32_t I2C_RTC_clockDrift(void);
+
+/** ===================================================
+ * @brief function to read the temperature of the RTC
+ * 
+ * @param convert 1: start a conversion and wait for it (up to 200ms),
+ * 0: value of the last conversion (automatic every 64s)
+ * @return temperature in 0.25 degree Celsius,
+ * I2C_RTC_TEMP_ERROR if the conversion did not end within 250ms
+ */
+int16_t I2C_RTC_readTemperature(uint8_t convert);
+
+/** ===================================================
+ * @brief function to read the aging offset
+ * 
+ * @return aging offset, one step is about 0.1ppm
+ */
+int8_t I2C_RTC_readAging(void);
+
+/** ===================================================
+ * @brief function to write the aging offset
+ * and start a conversion to use it at once
+ * 
+ * @param offset aging offset, positive values slow the RTC down
+ */
+void I2C_RTC_writeAging(int8_t offset);
+
+/** ===================================================
+ * @brief function to wait for the next second of the RTC
+ * (up to 1.1s, the seconds register is polled every 1ms)
+ * 
+ * @return epoch seconds of the new second,
+ * 0 if the RTC does not answer or the seconds do not count
+ */
+uint32_t I2C_RTC_waitSecond(void);
+
+/** ===================================================
+ * @brief function to start a drift calibration against a reference,
+ * f.e. a time synced by UART or a disciplined timer.
+ * Waits for the next second of the RTC (up to 1.1s) and
+ * reads the reference at its start.
+ * 
+ * @param referenceMs function returning the reference in ms
+ * @return 0 on success, 1 if the RTC does not answer
+ * (I2C_RTC_calibrateFinish keeps the aging offset then)
+ */
+uint8_t I2C_RTC_calibrateStart(uint32_t (*referenceMs)(void));
+
+/** ===================================================
+ * @brief function to finish a drift calibration, some hours
+ * after I2C_RTC_calibrateStart, and correct the aging offset.
+ * Waits for the next second of the RTC (up to 1.1s).
+ * 
+ * @param referenceMs function returning the reference in ms
+ * @return measured drift in 0.1ppm (positive: RTC was fast),
+ * 0 if less than I2C_RTC_CALIBRATE_MIN ms passed or the RTC did not answer
+ */
+int16_t I2C_RTC_calibrateFinish(uint32_t (*referenceMs)(void));
+
+#endif                              // End prevent duplicate forward
+/* _I2C_RTC_H */                    // declarations block
\ No newline at end of file
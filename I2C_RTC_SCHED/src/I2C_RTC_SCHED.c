@@ -0,0 +1,179 @@
+/**
+ * @file I2C_RTC_SCHED.c
+ *
+ * @author ClefaMedia
+ *
+ * @version 1.0
+ *
+ * @copyright
+ * Copyright (C) ClefaMedia 2021.
+ * All Rights GNU GLP Licensed.
+ *
+ * @brief This library was created to run cron-like schedules
+ * ("every 15 minutes", "weekdays 07:30") with the alarm 1 of the RTC (I2C_RTC).
+ *
+ * The schedules are a table in the flash. The next time one of them
+ * is due is calculated from the current time (no search minute by minute)
+ * and only this time is programmed into alarm 1. When the alarm matched,
+ * I2C_RTC_SCHED_run calls the due entries and programs the next time.
+ *
+ * f.e. with I2C_RTC_sleepUntilAlarm:
+ * while (1) { I2C_RTC_sleepUntilAlarm(); I2C_RTC_SCHED_run(); }
+ */
+
+
+#include "I2C_RTC_SCHED.h"
+#include "I2C_RTC.h"
+
+#define SCHED_NONE      0xFFFF          // no minute found
+#define SCHED_DAY       1440            // minutes of a day
+
+static const struct I2C_RTC_SCHED_entry *sched_table;  // entries (PROGMEM)
+static uint8_t sched_count;             // number of entries
+static uint32_t sched_next;             // epoch seconds of the next due entry (0 = none)
+
+// first minute of the day >= from matching hour, minute and step, without a search
+static uint16_t I2C_RTC_SCHED_minute(uint8_t hour, uint8_t minute, uint8_t step, uint16_t from)
+{
+    uint8_t h = from / 60;
+    uint8_t m = from % 60;
+
+    if (from >= SCHED_DAY)
+    {
+        return SCHED_NONE;                              // day is over, the next day is checked by the caller
+    }
+    if (hour != I2C_RTC_SCHED_ANY)
+    {
+        if (hour < h)
+        {
+            return SCHED_NONE;                          // hour is over today
+        }
+        if (hour > h)
+        {
+            return hour * 60 + minute;                  // first minute of the later hour
+        }
+    }
+    if (m <= minute)
+    {
+        return h * 60 + minute;
+    }
+    if (step)                                           // next step at or after m
+    {
+        uint16_t next = minute + (uint16_t)((m - minute + step - 1) / step) * step;
+        if (next < 60)
+        {
+            return h * 60 + next;
+        }
+    }
+    if ((hour == I2C_RTC_SCHED_ANY) && (h < 23))
+    {
+        return (h + 1) * 60 + minute;                   // first minute of the next hour
+    }
+    return SCHED_NONE;
+}
+
+// copy an entry from the table, 0 if the entry can never be due
+static uint8_t I2C_RTC_SCHED_load(uint8_t i, struct I2C_RTC_SCHED_entry *entry)
+{
+    memcpy_P(entry, &sched_table[i], sizeof(*entry));
+    return (entry->weekdays & I2C_RTC_SCHED_DAILY) && (entry->minute < 60)
+        && ((entry->hour < 24) || (entry->hour == I2C_RTC_SCHED_ANY));
+}
+
+// minutes from 00:00 of today to the first time after now the entry is due
+static uint16_t I2C_RTC_SCHED_due(const struct I2C_RTC_SCHED_entry *entry, uint8_t weekday, uint16_t now)
+{
+    for (uint8_t day = 0; day < 8; day++)               // same weekday next week at the latest
+    {
+        if (!(entry->weekdays & (1 << ((weekday - 1 + day) % 7))))
+        {
+            continue;
+        }
+        uint16_t minute = I2C_RTC_SCHED_minute(entry->hour, entry->minute, entry->step, day ? 0 : now + 1);
+        if (minute != SCHED_NONE)
+        {
+            return day * SCHED_DAY + minute;
+        }
+    }
+    return SCHED_NONE;
+}
+
+// call the entries due now (optional), find the next time and program alarm 1
+static uint8_t I2C_RTC_SCHED_plan(uint8_t call)
+{
+    struct rtc_datetime now;
+    struct I2C_RTC_SCHED_entry entry;
+    uint16_t next = SCHED_NONE;
+    uint8_t called = 0;
+
+    if (I2C_RTC_read(&now))                             // RTC does not answer
+    {
+        return 0;
+    }
+    uint8_t weekday = I2C_RTC_weekday(now.date, now.month, now.year);
+    uint16_t minute = now.hour * 60 + now.min;
+
+    for (uint8_t i = 0; i < sched_count; i++)
+    {
+        if (!I2C_RTC_SCHED_load(i, &entry))
+        {
+            continue;
+        }
+        if (call && (entry.weekdays & (1 << (weekday - 1)))
+            && (I2C_RTC_SCHED_minute(entry.hour, entry.minute, entry.step, minute) == minute))
+        {
+            entry.callback();                           // due in this minute
+            called++;
+        }
+        uint16_t due = I2C_RTC_SCHED_due(&entry, weekday, minute);
+        if (due < next)
+        {
+            next = due;
+        }
+    }
+
+    if (next == SCHED_NONE)
+    {
+        sched_next = 0;
+        I2C_RTC_disableAlarms(I2C_RTC_ALARM1);
+        return called;
+    }
+    sched_next = I2C_RTC_toEpoch(&now) - (minute * 60UL + now.sec) + next * 60UL;
+    I2C_RTC_fromEpoch(sched_next, &now);
+    I2C_RTC_setAlarm1(I2C_RTC_ALARM_DATE, now.date, now.hour, now.min, 0);  // within 8 days, the date is unique
+    return called;
+}
+
+void I2C_RTC_SCHED_init(const struct I2C_RTC_SCHED_entry *table, uint8_t count)
+{
+    sched_table = table;
+    sched_count = count;
+    I2C_RTC_SCHED_plan(0);
+}
+
+uint8_t I2C_RTC_SCHED_run(void)
+{
+    return I2C_RTC_SCHED_plan(1);
+}
+
+uint32_t I2C_RTC_SCHED_next(void)
+{
+    return sched_next;
+}
+
+/**
+ * This file is part of I2C_RTC_SCHED Library
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
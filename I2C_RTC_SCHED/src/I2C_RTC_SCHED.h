@@ -0,0 +1,106 @@
+/**
+ * @file I2C_RTC_SCHED.h
+ *
+ * @author ClefaMedia
+ *
+ * @version 1.0
+ *
+ * @copyright
+ * Copyright (C) ClefaMedia 2021.
+ * All Rights GNU GLP Licensed.
+ *
+ * @brief This library was created to run cron-like schedules
+ * ("every 15 minutes", "weekdays 07:30") with the alarm 1 of the RTC (I2C_RTC).
+ *
+ * The schedules are a table in the flash. The next time one of them
+ * is due is calculated from the current time (no search minute by minute)
+ * and only this time is programmed into alarm 1. When the alarm matched,
+ * I2C_RTC_SCHED_run calls the due entries and programs the next time.
+ *
+ * f.e. with I2C_RTC_sleepUntilAlarm:
+ * while (1) { I2C_RTC_sleepUntilAlarm(); I2C_RTC_SCHED_run(); }
+ */
+
+
+#ifndef _I2C_RTC_SCHED_H                // prevents duplicate
+#define _I2C_RTC_SCHED_H   1            // forward declarations
+
+#include <avr/io.h>                     // requires AVR Input/Output
+#include <avr/pgmspace.h>               // requires PROGMEM
+#include <inttypes.h>                   // requires Inttypes
+
+// weekdays of an entry (bitmask)
+#define I2C_RTC_SCHED_MONDAY    0x01
+#define I2C_RTC_SCHED_TUESDAY   0x02
+#define I2C_RTC_SCHED_WEDNESDAY 0x04
+#define I2C_RTC_SCHED_THURSDAY  0x08
+#define I2C_RTC_SCHED_FRIDAY    0x10
+#define I2C_RTC_SCHED_SATURDAY  0x20
+#define I2C_RTC_SCHED_SUNDAY    0x40
+#define I2C_RTC_SCHED_WEEKDAYS  0x1F
+#define I2C_RTC_SCHED_WEEKEND   0x60
+#define I2C_RTC_SCHED_DAILY     0x7F
+
+// every hour
+#define I2C_RTC_SCHED_ANY       0xFF
+
+/** @brief schedule entry, f.e.
+ * every 15 minutes: {I2C_RTC_SCHED_DAILY, I2C_RTC_SCHED_ANY, 0, 15, callback}
+ * weekdays 07:30:   {I2C_RTC_SCHED_WEEKDAYS, 7, 30, 0, callback}
+ */
+struct I2C_RTC_SCHED_entry
+{
+    uint8_t weekdays;                   // I2C_RTC_SCHED_MONDAY | ... (bitmask)
+    uint8_t hour;                       // hour 0 - 23 or I2C_RTC_SCHED_ANY
+    uint8_t minute;                     // first minute 0 - 59
+    uint8_t step;                       // minutes to the next call in the same hour (0 = only once)
+    void (*callback)(void);             // function called when the entry is due
+};
+
+/** ===================================================
+ * @brief function to start the scheduler with a table
+ * and program the next time into alarm 1.
+ *
+ * The I2C-Bus must be initialized before.
+ *
+ * @param table entries in PROGMEM
+ * @param count number of entries
+ */
+void I2C_RTC_SCHED_init(const struct I2C_RTC_SCHED_entry *table, uint8_t count);
+
+/** ===================================================
+ * @brief function to call the due entries and program
+ * the next time into alarm 1.
+ * Has to be called after alarm 1 matched,
+ * f.e. after I2C_RTC_sleepUntilAlarm returned.
+ *
+ * @return number of called entries
+ */
+uint8_t I2C_RTC_SCHED_run(void);
+
+/** ===================================================
+ * @brief function to get the next time an entry is due
+ *
+ * @return epoch seconds (I2C_RTC_toEpoch), 0 if no entry is valid
+ */
+uint32_t I2C_RTC_SCHED_next(void);
+
+#endif                               // end prevent duplicate forward
+/* _I2C_RTC_SCHED_H */               // declarations block
+
+/**
+ * This file is part of I2C_RTC_SCHED Library
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
@@ -0,0 +1,375 @@
+/**
+ * @file I2C_RTC_SYNC.c
+ *
+ * @author ClefaMedia
+ *
+ * @version 1.0
+ *
+ * @copyright
+ * Copyright (C) ClefaMedia 2021.
+ * All Rights GNU GLP Licensed.
+ *
+ * @brief This library was created to sync the RTC (I2C_RTC) with a
+ * time server on the UART, f.e. tools/timesync.py on a PC.
+ *
+ * Every request is sent at the falling edge of the 1Hz square wave (SQW on PD2),
+ * when the RTC is exactly at a full second. The server answers with the
+ * time it received the request and the time it sent the reply, so the
+ * offset of the RTC is found without the delay of the line (like NTP).
+ * The round trip with the smallest delay is used. The RTC is only written
+ * if the offset is above a threshold, exactly when the server time
+ * reaches a full second (the divider of the RTC restarts with the write).
+ * The skew is estimated from the offsets of the syncs without a write.
+ *
+ * Frames (little endian): 0xA5, type, payload, XOR of type and payload
+ * + request 'Q': seq, seconds (4), ms (2)
+ * + reply   'R': seq, received seconds (4), ms (2), sent seconds (4), ms (2)
+ * + report  'S': result, offset ms (4), delay ms (2), skew 0.1ppm (2)
+ * Times are epoch seconds in UTC.
+ *
+ * This library uses the USART0 and the TIMER2_COMPA interrupt vector.
+ */
+
+
+#include "I2C_RTC_SYNC.h"
+#include "I2C_RTC.h"
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+
+// frames
+#define SYNC_START      0xA5            // first byte of a frame
+#define SYNC_REQUEST    'Q'
+#define SYNC_REPLY      'R'
+#define SYNC_REPORT     'S'
+#define SYNC_REPLY_LEN  13              // payload of a reply
+
+#define SYNC_SKEW_MIN   600             // seconds between two offsets for the skew
+#define SYNC_OFFSET_MAX 100000L         // seconds of an offset in ms
+
+static volatile uint16_t sync_ms;       // ms since the last edge of the square wave
+static uint8_t sync_seq;                // sequence number of the requests
+static int32_t sync_offset;             // server - RTC in ms of the last sync
+static int16_t sync_skew;               // drift of the RTC in 0.1ppm
+static uint32_t sync_refRtc;            // RTC seconds of the first offset for the skew (0 = none)
+static int32_t sync_refOffset;          // first offset for the skew
+
+ISR(TIMER2_COMPA_vect)
+{
+    sync_ms++;
+}
+
+// read the ms counter
+static uint16_t I2C_RTC_SYNC_ms(void)
+{
+    uint16_t ms;
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        ms = sync_ms;
+    }
+    return ms;
+}
+
+// wait for the falling edge of the square wave and restart the ms counter, 1 if there is none
+static uint8_t I2C_RTC_SYNC_edge(void)
+{
+    uint16_t start = I2C_RTC_SYNC_ms();
+
+    while (!(I2C_RTC_SYNC_SQW_PIN & (1 << I2C_RTC_SYNC_SQW_BIT)))   // wait for high
+    {
+        if ((uint16_t)(I2C_RTC_SYNC_ms() - start) > 1500)
+        {
+            return 1;
+        }
+    }
+    while (I2C_RTC_SYNC_SQW_PIN & (1 << I2C_RTC_SYNC_SQW_BIT))      // wait for low
+    {
+        if ((uint16_t)(I2C_RTC_SYNC_ms() - start) > 1500)
+        {
+            return 1;
+        }
+    }
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        TCNT2 = 0;
+        sync_ms = 0;
+    }
+    return 0;
+}
+
+static void I2C_RTC_SYNC_putc(uint8_t c)
+{
+    while (!(UCSR0A & (1 << UDRE0)))
+    {
+        ;
+    }
+    UDR0 = c;
+}
+
+// receive a byte until the timeout of a request, -1 after the timeout
+static int16_t I2C_RTC_SYNC_getc(uint16_t sent)
+{
+    while (!(UCSR0A & (1 << RXC0)))
+    {
+        if ((uint16_t)(I2C_RTC_SYNC_ms() - sent) > I2C_RTC_SYNC_TIMEOUT)
+        {
+            return -1;
+        }
+    }
+    return UDR0;
+}
+
+static void I2C_RTC_SYNC_send(uint8_t type, const uint8_t *payload, uint8_t length)
+{
+    uint8_t check = type;
+
+    I2C_RTC_SYNC_putc(SYNC_START);
+    I2C_RTC_SYNC_putc(type);
+    while (length--)
+    {
+        check ^= *payload;
+        I2C_RTC_SYNC_putc(*payload++);
+    }
+    I2C_RTC_SYNC_putc(check);
+}
+
+// receive the reply to a request, 0 on success
+static uint8_t I2C_RTC_SYNC_receive(uint8_t *payload, uint16_t sent)
+{
+    int16_t c;
+
+    do                                  // find the start of the reply
+    {
+        c = I2C_RTC_SYNC_getc(sent);
+        if (c < 0)
+        {
+            return 1;
+        }
+    } while (c != SYNC_START);
+    if (I2C_RTC_SYNC_getc(sent) != SYNC_REPLY)
+    {
+        return 1;
+    }
+
+    uint8_t check = SYNC_REPLY;
+    for (uint8_t i = 0; i <= SYNC_REPLY_LEN; i++)   // payload and check
+    {
+        c = I2C_RTC_SYNC_getc(sent);
+        if (c < 0)
+        {
+            return 1;
+        }
+        if (i < SYNC_REPLY_LEN)
+        {
+            payload[i] = c;
+        }
+        check ^= c;
+    }
+    return check;                       // 0 if the XOR of everything matches
+}
+
+static uint8_t *I2C_RTC_SYNC_put(uint8_t *p, uint32_t value, uint8_t length)
+{
+    while (length--)
+    {
+        *p++ = value;
+        value >>= 8;
+    }
+    return p;
+}
+
+static uint32_t I2C_RTC_SYNC_get(const uint8_t *p, uint8_t length)
+{
+    uint32_t value = 0;
+
+    while (length--)
+    {
+        value = (value << 8) | p[length];
+    }
+    return value;
+}
+
+// server - RTC in ms, limited
+static int32_t I2C_RTC_SYNC_ms32(int32_t seconds, int16_t ms)
+{
+    if (seconds >= SYNC_OFFSET_MAX)
+    {
+        return SYNC_OFFSET_MAX * 1000;
+    }
+    if (seconds <= -SYNC_OFFSET_MAX)
+    {
+        return -SYNC_OFFSET_MAX * 1000;
+    }
+    return seconds * 1000 + ms;
+}
+
+static void I2C_RTC_SYNC_report(uint8_t result, uint16_t delay)
+{
+    uint8_t payload[9];
+    uint8_t *p = payload;
+
+    *p++ = result;
+    p = I2C_RTC_SYNC_put(p, sync_offset, 4);
+    p = I2C_RTC_SYNC_put(p, delay, 2);
+    I2C_RTC_SYNC_put(p, sync_skew, 2);
+    I2C_RTC_SYNC_send(SYNC_REPORT, payload, sizeof(payload));
+}
+
+void I2C_RTC_SYNC_init(void)
+{
+    UBRR0 = F_CPU / 16 / I2C_RTC_SYNC_BAUD - 1;
+    UCSR0A = 0x00;
+    UCSR0B = (1 << RXEN0) | (1 << TXEN0);                   // receiver and transmitter
+    UCSR0C = (1 << UCSZ01) | (1 << UCSZ00);                 // 8N1
+
+    TCCR2A = (1 << WGM21);                                  // CTC mode
+    TCCR2B = (1 << CS22);                                   // prescaler 64
+    OCR2A = F_CPU / 64 / 1000 - 1;                          // 1ms
+    TIMSK2 |= (1 << OCIE2A);                                // enable interrupt
+
+    I2C_RTC_SYNC_SQW_DDR &= ~(1 << I2C_RTC_SYNC_SQW_BIT);   // input
+    I2C_RTC_SYNC_SQW_PORT |= (1 << I2C_RTC_SYNC_SQW_BIT);   // pull-up for the open drain output
+    I2C_RTC_setSQW(0x00);                                   // 1Hz square wave
+}
+
+uint8_t I2C_RTC_SYNC_run(uint16_t thresholdMs)
+{
+    struct rtc_datetime now;
+    uint8_t payload[SYNC_REPLY_LEN];
+    uint16_t best = 0xFFFF;             // smallest delay
+    uint32_t rtc = 0;                   // RTC seconds of the best round trip
+    int32_t offsetSeconds = 0;          // server - RTC of the best round trip
+    int16_t offsetMs = 0;               // 0 - 999
+
+    for (uint8_t i = 0; i < I2C_RTC_SYNC_SAMPLES; i++)
+    {
+        if (I2C_RTC_SYNC_edge() || I2C_RTC_read(&now))
+        {
+            break;                      // no square wave or no RTC
+        }
+        uint32_t t1 = I2C_RTC_toEpoch(&now);            // RTC seconds since the edge
+        uint16_t t1Ms = I2C_RTC_SYNC_ms();
+
+        while (UCSR0A & (1 << RXC0))                    // drop old bytes
+        {
+            (void)UDR0;
+        }
+        uint8_t *p = payload;
+        *p++ = ++sync_seq;
+        p = I2C_RTC_SYNC_put(p, t1, 4);
+        I2C_RTC_SYNC_put(p, t1Ms, 2);
+        I2C_RTC_SYNC_send(SYNC_REQUEST, payload, 7);
+
+        if (I2C_RTC_SYNC_receive(payload, t1Ms) || (payload[0] != sync_seq))
+        {
+            continue;                   // lost, broken or old reply
+        }
+        uint16_t t4Ms = I2C_RTC_SYNC_ms();
+        uint32_t t2 = I2C_RTC_SYNC_get(payload + 1, 4);
+        int16_t t2Ms = I2C_RTC_SYNC_get(payload + 5, 2);
+        uint32_t t3 = I2C_RTC_SYNC_get(payload + 7, 4);
+        int16_t t3Ms = I2C_RTC_SYNC_get(payload + 11, 2);
+
+        // round trip without the time the server needed
+        int32_t delay = (int32_t)(t4Ms - t1Ms) - ((int32_t)(t3 - t2) * 1000 + t3Ms - t2Ms);
+        if ((delay < 0) || (delay >= best))
+        {
+            continue;
+        }
+        best = delay;
+        rtc = t1;
+
+        // server time at t1 is t2 - delay / 2, offset in seconds and 0 - 999 ms
+        offsetSeconds = (int32_t)(t2 - t1);
+        int16_t ms = t2Ms - delay / 2 - t1Ms;
+        while (ms < 0)
+        {
+            ms += 1000;
+            offsetSeconds--;
+        }
+        while (ms >= 1000)
+        {
+            ms -= 1000;
+            offsetSeconds++;
+        }
+        offsetMs = ms;
+    }
+
+    if (best == 0xFFFF)
+    {
+        I2C_RTC_SYNC_report(I2C_RTC_SYNC_NOREPLY, 0);
+        return I2C_RTC_SYNC_NOREPLY;
+    }
+    sync_offset = I2C_RTC_SYNC_ms32(offsetSeconds, offsetMs);
+
+    if ((sync_offset <= (int32_t)thresholdMs) && (sync_offset >= -(int32_t)thresholdMs))
+    {
+        if (!sync_refRtc)
+        {
+            sync_refRtc = rtc;          // first offset since the last write
+            sync_refOffset = sync_offset;
+        }
+        else if (rtc - sync_refRtc >= SYNC_SKEW_MIN)
+        {
+            // the offset falls when the RTC is fast, ms per s * 10000 = 0.1ppm
+            int32_t skew = (sync_refOffset - sync_offset) * 10000L / (int32_t)(rtc - sync_refRtc);
+            sync_skew = (skew > 32767) ? 32767 : (skew < -32768) ? -32768 : skew;
+        }
+        I2C_RTC_SYNC_report(I2C_RTC_SYNC_OK, best);
+        return I2C_RTC_SYNC_OK;
+    }
+
+    // write the RTC when the server reaches the next full second after an edge
+    if (I2C_RTC_SYNC_edge() || I2C_RTC_read(&now))
+    {
+        I2C_RTC_SYNC_report(I2C_RTC_SYNC_NOREPLY, best);
+        return I2C_RTC_SYNC_NOREPLY;
+    }
+    uint32_t epoch = I2C_RTC_toEpoch(&now) + offsetSeconds;    // server seconds at the edge
+    uint16_t wait = 0;
+    if (offsetMs)
+    {
+        wait = 1000 - offsetMs;
+        epoch++;
+    }
+    while (wait <= I2C_RTC_SYNC_ms())                           // too late for this second
+    {
+        wait += 1000;
+        epoch++;
+    }
+    I2C_RTC_fromEpoch(epoch, &now);
+    while (I2C_RTC_SYNC_ms() < wait)
+    {
+        ;
+    }
+    I2C_RTC_setDateTime(now.sec, now.min, now.hour, now.date, now.month, now.year);
+    sync_refRtc = 0;                    // the skew starts again
+    I2C_RTC_SYNC_report(I2C_RTC_SYNC_SET, best);
+    return I2C_RTC_SYNC_SET;
+}
+
+int32_t I2C_RTC_SYNC_offset(void)
+{
+    return sync_offset;
+}
+
+int16_t I2C_RTC_SYNC_skew(void)
+{
+    return sync_skew;
+}
+
+/**
+ * This file is part of I2C_RTC_SYNC Library
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
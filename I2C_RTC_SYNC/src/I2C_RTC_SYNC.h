@@ -0,0 +1,117 @@
+/**
+ * @file I2C_RTC_SYNC.h
+ *
+ * @author ClefaMedia
+ *
+ * @version 1.0
+ *
+ * @copyright
+ * Copyright (C) ClefaMedia 2021.
+ * All Rights GNU GLP Licensed.
+ *
+ * @brief This library was created to sync the RTC (I2C_RTC) with a
+ * time server on the UART, f.e. tools/timesync.py on a PC.
+ *
+ * Every request is sent at the falling edge of the 1Hz square wave (SQW on PD2),
+ * when the RTC is exactly at a full second. The server answers with the
+ * time it received the request and the time it sent the reply, so the
+ * offset of the RTC is found without the delay of the line (like NTP).
+ * The round trip with the smallest delay is used. The RTC is only written
+ * if the offset is above a threshold, exactly when the server time
+ * reaches a full second (the divider of the RTC restarts with the write).
+ * The skew is estimated from the offsets of the syncs without a write.
+ *
+ * Frames (little endian): 0xA5, type, payload, XOR of type and payload
+ * + request 'Q': seq, seconds (4), ms (2)
+ * + reply   'R': seq, received seconds (4), ms (2), sent seconds (4), ms (2)
+ * + report  'S': result, offset ms (4), delay ms (2), skew 0.1ppm (2)
+ * Times are epoch seconds in UTC.
+ *
+ * This library uses the USART0 and the TIMER2_COMPA interrupt vector.
+ */
+
+
+#ifndef _I2C_RTC_SYNC_H                 // prevents duplicate
+#define _I2C_RTC_SYNC_H   1             // forward declarations
+
+#include <avr/io.h>                     // requires AVR Input/Output
+#include <inttypes.h>                   // requires Inttypes
+
+// baud rate of the UART
+#ifndef I2C_RTC_SYNC_BAUD
+#define I2C_RTC_SYNC_BAUD       38400UL
+#endif
+
+// round trips of a sync, the one with the smallest delay is used
+#ifndef I2C_RTC_SYNC_SAMPLES
+#define I2C_RTC_SYNC_SAMPLES    4
+#endif
+
+// time to wait for a reply in ms
+#define I2C_RTC_SYNC_TIMEOUT    500
+
+// SQW input
+#define I2C_RTC_SYNC_SQW_DDR    DDRD
+#define I2C_RTC_SYNC_SQW_PORT   PORTD
+#define I2C_RTC_SYNC_SQW_PIN    PIND
+#define I2C_RTC_SYNC_SQW_BIT    PD2
+
+// results of I2C_RTC_SYNC_run
+#define I2C_RTC_SYNC_OK         0       // offset is below the threshold
+#define I2C_RTC_SYNC_SET        1       // RTC was written
+#define I2C_RTC_SYNC_NOREPLY    2       // no valid reply from the server
+
+/** ===================================================
+ * @brief function to start the UART, Timer2 (1ms)
+ * and the 1Hz square wave of the RTC
+ *
+ * The I2C-Bus must be initialized before.
+ * Global interrupts must be enabled with sei().
+ */
+void I2C_RTC_SYNC_init(void);
+
+/** ===================================================
+ * @brief function to sync the RTC with the server.
+ * Takes I2C_RTC_SYNC_SAMPLES + 1 seconds up to I2C_RTC_SYNC_SAMPLES + 2 seconds
+ * and sends a report frame at the end.
+ *
+ * @param thresholdMs max. offset in ms without writing the RTC
+ * @return I2C_RTC_SYNC_OK, I2C_RTC_SYNC_SET or I2C_RTC_SYNC_NOREPLY
+ */
+uint8_t I2C_RTC_SYNC_run(uint16_t thresholdMs);
+
+/** ===================================================
+ * @brief function to get the offset of the last sync
+ *
+ * @return server - RTC in ms (limited to +/- 100000000)
+ */
+int32_t I2C_RTC_SYNC_offset(void);
+
+/** ===================================================
+ * @brief function to get the skew of the RTC, estimated from the
+ * syncs since the last write (at least 10 minutes apart)
+ *
+ * @return drift in 0.1ppm (positive: RTC is fast), f.e. for
+ * I2C_RTC_writeAging(I2C_RTC_readAging() + skew)
+ */
+int16_t I2C_RTC_SYNC_skew(void);
+
+#endif                               // end prevent duplicate forward
+/* _I2C_RTC_SYNC_H */                // declarations block
+
+/**
+ * This file is part of I2C_RTC_SYNC Library
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
@@ -0,0 +1,76 @@
+#!/usr/bin/env python3
+"""
+Time server for the I2C_RTC_SYNC library.
+
+Answers every request frame of the AVR with the UTC time the request
+was received and the time the reply is sent, and prints the reports.
+
+usage: timesync.py PORT [BAUD]
+requires pyserial (pip install pyserial)
+
+This file is part of I2C_RTC_SYNC Library, GNU GPL v3 (see I2C_RTC_SYNC.h)
+"""
+
+import struct
+import sys
+import time
+
+import serial
+
+START = 0xA5
+REQUEST = ord('Q')
+REPLY = ord('R')
+REPORT = ord('S')
+PAYLOAD = {REQUEST: 7, REPORT: 9}
+RESULTS = {0: 'ok', 1: 'set', 2: 'no reply'}
+
+
+def now():
+    """UTC epoch seconds and ms"""
+    t = time.time()
+    return int(t), int((t % 1) * 1000)
+
+
+def checksum(data):
+    check = 0
+    for b in data:
+        check ^= b
+    return check
+
+
+def read_frame(port):
+    """wait for a frame, returns type, payload and the time of the last byte"""
+    while True:
+        if port.read(1) != bytes([START]):
+            continue
+        head = port.read(1)
+        if not head or head[0] not in PAYLOAD:
+            continue
+        body = port.read(PAYLOAD[head[0]] + 1)
+        received = now()
+        if len(body) == PAYLOAD[head[0]] + 1 and checksum(head + body) == 0:
+            return head[0], body[:-1], received
+
+
+def main():
+    if len(sys.argv) < 2:
+        sys.exit(__doc__)
+    baud = int(sys.argv[2]) if len(sys.argv) > 2 else 38400
+    port = serial.Serial(sys.argv[1], baud, timeout=2)
+
+    while True:
+        kind, payload, (t2, t2_ms) = read_frame(port)
+        if kind == REQUEST:
+            seq, t1, t1_ms = struct.unpack('<BIH', payload)
+            t3, t3_ms = now()
+            body = bytes([REPLY]) + struct.pack('<BIHIH', seq, t2, t2_ms, t3, t3_ms)
+            port.write(bytes([START]) + body + bytes([checksum(body)]))
+            print('request %3d  rtc %d.%03d  server %d.%03d' % (seq, t1, t1_ms, t2, t2_ms))
+        else:
+            result, offset, delay, skew = struct.unpack('<BiHh', payload)
+            print('report: %s, offset %d ms, delay %d ms, skew %.1f ppm'
+                  % (RESULTS.get(result, result), offset, delay, skew / 10))
+
+
+if __name__ == '__main__':
+    main()
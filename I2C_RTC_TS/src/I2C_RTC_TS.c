@@ -0,0 +1,173 @@
+/**
+ * @file I2C_RTC_TS.c
+ *
+ * @author ClefaMedia
+ *
+ * @version 1.0
+ *
+ * @copyright
+ * Copyright (C) ClefaMedia 2021.
+ * All Rights GNU GLP Licensed.
+ *
+ * @brief This library was created to get timestamps with milliseconds
+ * from the RTC (I2C_RTC) without I2C communication.
+ *
+ * The 1.024kHz square wave of the RTC (or its 32kHz output with
+ * I2C_RTC_TS_32KHZ defined) is the external clock of Timer0 on T0 (PD4).
+ * The overflow interrupt counts the seconds, a timestamp is the counted
+ * seconds plus the timer value, so it is as accurate as the RTC.
+ * The seconds are latched from the RTC when the next second starts
+ * (I2C_RTC_TS_sync).
+ *
+ * With the 1.024kHz square wave the SQW pin can not be used for
+ * the 1Hz clock (I2C_CLOCK) or the alarms.
+ *
+ * This library uses the TIMER0_OVF interrupt vector.
+ */
+
+
+#include "I2C_RTC_TS.h"
+#include "I2C_RTC.h"
+#include <I2C.h>
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+#include <util/delay.h>
+
+// clock of Timer0: ticks per second and the shift to divide by them
+#ifdef I2C_RTC_TS_32KHZ
+#define TS_TICKS        32768UL
+#define TS_SHIFT        15
+#else
+#define TS_TICKS        1024UL
+#define TS_SHIFT        10
+#endif
+#define TS_OVERFLOWS    (TS_TICKS / 256)    // overflows of Timer0 per second
+#define TS_SYNC_POLLS   11000               // polls of the seconds 100us apart, a bit more than 1s
+
+static volatile uint32_t ts_seconds;    // epoch seconds
+static volatile uint8_t ts_overflows;   // overflows in the current second
+
+ISR(TIMER0_OVF_vect)
+{
+    if (++ts_overflows >= TS_OVERFLOWS)
+    {
+        ts_overflows = 0;
+        ts_seconds++;
+    }
+}
+
+uint8_t I2C_RTC_TS_init(void)
+{
+#ifdef I2C_RTC_TS_32KHZ
+    uint8_t status = I2C_RTC_readRegister(I2C_RTC_ADDRESS_STATUS);
+    I2C_RTC_writeRegister(I2C_RTC_ADDRESS_STATUS, status | I2C_RTC_STATUS_EN32KHZ);  // 32kHz output
+#else
+    I2C_RTC_setSQW(0x01);               // 1.024kHz square wave
+#endif
+
+    I2C_RTC_TS_T0_DDR &= ~(1 << I2C_RTC_TS_T0_BIT);     // input
+    I2C_RTC_TS_T0_PORT |= (1 << I2C_RTC_TS_T0_BIT);     // pull-up for the open drain output
+    TCCR0A = 0x00;                                      // normal mode
+    TCCR0B = (1 << CS02) | (1 << CS01);                 // external clock on T0, falling edge
+    TIMSK0 |= (1 << TOIE0);                             // enable overflow interrupt
+
+    return I2C_RTC_TS_sync();
+}
+
+// read the seconds register without waiting for the bus, 0xFF if the RTC does not answer
+static uint8_t I2C_RTC_TS_seconds(void)
+{
+    uint8_t sec;
+
+    if (I2C_start(I2C_RTC_ADDRESS | I2C_RTC_WRITE))
+    {
+        I2C_stop();
+        return 0xFF;
+    }
+    I2C_write(I2C_RTC_ADDRESS_SECONDS);
+    I2C_repStart(I2C_RTC_ADDRESS | I2C_RTC_READ);
+    sec = I2C_read(I2C_NAK);
+    I2C_stop();
+    return sec;
+}
+
+uint8_t I2C_RTC_TS_sync(void)
+{
+    struct rtc_datetime now;
+    uint8_t sec = I2C_RTC_TS_seconds();
+    uint8_t next = sec;
+    uint16_t polls = 0;
+
+    while ((next == sec) && (sec != 0xFF))
+    {
+        if (++polls > TS_SYNC_POLLS)
+        {
+            return 1;                   // seconds do not count, the oscillator stopped
+        }
+        _delay_us(100);                 // wait for the next second, short polls for a small error
+        next = I2C_RTC_TS_seconds();
+    }
+    if ((sec == 0xFF) || (next == 0xFF))
+    {
+        return 1;                       // RTC does not answer
+    }
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        TCNT0 = 0;                      // timer starts with the second
+        TIFR0 = (1 << TOV0);
+        ts_overflows = 0;
+    }
+
+    if (I2C_RTC_read(&now))             // date and time of the new second
+    {
+        return 1;
+    }
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        ts_seconds = I2C_RTC_toEpoch(&now);
+    }
+    return 0;
+}
+
+void I2C_RTC_TS_get(struct I2C_RTC_TS_stamp *stamp)
+{
+    uint8_t count;
+    uint8_t overflows;
+    uint32_t seconds;
+
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        count = TCNT0;
+        overflows = ts_overflows;
+        seconds = ts_seconds;
+        if ((TIFR0 & (1 << TOV0)) && (count < 128))     // overflow is not counted yet
+        {
+            if (++overflows >= TS_OVERFLOWS)
+            {
+                overflows = 0;
+                seconds++;
+            }
+        }
+    }
+
+    uint16_t ticks = (overflows << 8) | count;
+    stamp->seconds = seconds;
+    stamp->ms = ((uint32_t)ticks * 1000) >> TS_SHIFT;
+}
+
+/**
+ * This file is part of I2C_RTC_TS Library
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
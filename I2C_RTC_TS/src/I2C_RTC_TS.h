@@ -0,0 +1,94 @@
+/**
+ * @file I2C_RTC_TS.h
+ *
+ * @author ClefaMedia
+ *
+ * @version 1.0
+ *
+ * @copyright
+ * Copyright (C) ClefaMedia 2021.
+ * All Rights GNU GLP Licensed.
+ *
+ * @brief This library was created to get timestamps with milliseconds
+ * from the RTC (I2C_RTC) without I2C communication.
+ *
+ * The 1.024kHz square wave of the RTC (or its 32kHz output with
+ * I2C_RTC_TS_32KHZ defined) is the external clock of Timer0 on T0 (PD4).
+ * The overflow interrupt counts the seconds, a timestamp is the counted
+ * seconds plus the timer value, so it is as accurate as the RTC.
+ * The seconds are latched from the RTC when the next second starts
+ * (I2C_RTC_TS_sync).
+ *
+ * With the 1.024kHz square wave the SQW pin can not be used for
+ * the 1Hz clock (I2C_CLOCK) or the alarms.
+ *
+ * This library uses the TIMER0_OVF interrupt vector.
+ */
+
+
+#ifndef _I2C_RTC_TS_H                   // prevents duplicate
+#define _I2C_RTC_TS_H   1               // forward declarations
+
+#include <avr/io.h>                     // requires AVR Input/Output
+#include <inttypes.h>                   // requires Inttypes
+
+// clock input of Timer0 (T0)
+#define I2C_RTC_TS_T0_DDR   DDRD
+#define I2C_RTC_TS_T0_PORT  PORTD
+#define I2C_RTC_TS_T0_BIT   PD4
+
+/** @brief timestamp */
+struct I2C_RTC_TS_stamp
+{
+    uint32_t seconds;                   // epoch seconds (I2C_RTC_toEpoch)
+    uint16_t ms;                        // milliseconds 0 - 999
+};
+
+/** ===================================================
+ * @brief function to start the clock of Timer0 from the RTC
+ * and latch the seconds (I2C_RTC_TS_sync).
+ *
+ * The I2C-Bus must be initialized before.
+ * Global interrupts must be enabled with sei().
+ *
+ * @return 0 on success, 1 if the RTC does not answer
+ */
+uint8_t I2C_RTC_TS_init(void);
+
+/** ===================================================
+ * @brief function to latch the seconds of the RTC:
+ * waits until the next second starts (up to 1.1s) and
+ * restarts Timer0, f.e. after the RTC was set.
+ *
+ * @return 0 on success, 1 if the RTC does not answer
+ * or its seconds do not count
+ */
+uint8_t I2C_RTC_TS_sync(void);
+
+/** ===================================================
+ * @brief function to get the current timestamp,
+ * no I2C communication
+ *
+ * @param stamp seconds and milliseconds
+ */
+void I2C_RTC_TS_get(struct I2C_RTC_TS_stamp *stamp);
+
+#endif                               // end prevent duplicate forward
+/* _I2C_RTC_TS_H */                  // declarations block
+
+/**
+ * This file is part of I2C_RTC_TS Library
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
@@ -0,0 +1,182 @@
+/**
+ * @file I2C_RTC_TZ.c
+ *
+ * @author ClefaMedia
+ *
+ * @version 1.0
+ *
+ * @copyright
+ * Copyright (C) ClefaMedia 2021.
+ * All Rights GNU GLP Licensed.
+ *
+ * @brief This library was created to show the local time
+ * while the RTC (I2C_RTC) runs in UTC.
+ *
+ * A timezone is a rule in the flash: offset of the standard and the
+ * daylight saving time and the days (f.e. last Sunday of March) and
+ * local times of the changes. The rule is only evaluated for the next
+ * change, until then a conversion is a compare and an add. When the
+ * change is reached (or the time jumps back before the last one),
+ * the next change is calculated again.
+ */
+
+
+#include "I2C_RTC_TZ.h"
+
+#define TZ_NEVER        0xFFFFFFFFUL    // no next change
+
+// offsets in minutes, changes: month, week, weekday, local hour
+const struct I2C_RTC_TZ_rule I2C_RTC_TZ_utc PROGMEM = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+const struct I2C_RTC_TZ_rule I2C_RTC_TZ_cet PROGMEM = {
+    60, 120, 3, I2C_RTC_TZ_LAST, 7, 2, 10, I2C_RTC_TZ_LAST, 7, 3
+};
+const struct I2C_RTC_TZ_rule I2C_RTC_TZ_uk PROGMEM = {
+    0, 60, 3, I2C_RTC_TZ_LAST, 7, 1, 10, I2C_RTC_TZ_LAST, 7, 2
+};
+const struct I2C_RTC_TZ_rule I2C_RTC_TZ_usEastern PROGMEM = {
+    -300, -240, 3, 2, 7, 2, 11, 1, 7, 2
+};
+
+static const struct I2C_RTC_TZ_rule *tz_rule = &I2C_RTC_TZ_utc;    // current timezone (PROGMEM)
+static uint32_t tz_from;                // UTC of the last change
+static uint32_t tz_next;                // UTC of the next change
+static int32_t tz_offset;               // local time - UTC in seconds until the next change
+static uint8_t tz_dst;                  // daylight saving time until the next change
+
+// UTC of a change: weekday in a week of a month, local hour with the offset before the change
+static uint32_t I2C_RTC_TZ_change(uint8_t year, uint8_t month, uint8_t week, uint8_t weekday, uint8_t hour, int16_t offset)
+{
+    struct rtc_datetime change = {0, 0, hour, weekday, 1, month, year, 0};
+    uint8_t first = I2C_RTC_weekday(1, month, year);
+
+    change.date = 1 + (weekday + 7 - first) % 7;        // first of these weekdays in the month
+    if (week >= I2C_RTC_TZ_LAST)
+    {
+        change.date += 28;
+        if (change.date > I2C_RTC_monthDays(month, year))
+        {
+            change.date -= 7;                           // the 4th one is the last one
+        }
+    }
+    else
+    {
+        change.date += (week - 1) * 7;
+    }
+    return I2C_RTC_toEpoch(&change) - offset * 60L;
+}
+
+// both changes of a year in UTC in their order, returns 1 if the first one starts DST
+static uint8_t I2C_RTC_TZ_changes(const struct I2C_RTC_TZ_rule *rule, uint8_t year, uint32_t *first, uint32_t *second)
+{
+    uint32_t start = I2C_RTC_TZ_change(year, rule->startMonth, rule->startWeek, rule->startWeekday,
+        rule->startHour, rule->stdOffset);
+    uint32_t end = I2C_RTC_TZ_change(year, rule->endMonth, rule->endWeek, rule->endWeekday,
+        rule->endHour, rule->dstOffset);
+
+    if (start < end)                                    // northern hemisphere
+    {
+        *first = start;
+        *second = end;
+        return 1;
+    }
+    *first = end;                                       // southern hemisphere
+    *second = start;
+    return 0;
+}
+
+// evaluate the rule for the changes around a time
+static void I2C_RTC_TZ_update(uint32_t utc)
+{
+    struct I2C_RTC_TZ_rule rule;
+    struct rtc_datetime now;
+    uint32_t first, second, other;
+
+    memcpy_P(&rule, tz_rule, sizeof(rule));
+    if (!rule.startMonth)                               // no daylight saving time
+    {
+        tz_from = 0;
+        tz_next = TZ_NEVER;
+        tz_offset = rule.stdOffset * 60L;
+        tz_dst = 0;
+        return;
+    }
+
+    I2C_RTC_fromEpoch(utc, &now);
+    uint8_t firstIsStart = I2C_RTC_TZ_changes(&rule, now.year, &first, &second);
+
+    if (utc < first)                                    // still after the second change of the year before
+    {
+        tz_dst = !firstIsStart;
+        tz_from = 0;
+        if (now.year)
+        {
+            I2C_RTC_TZ_changes(&rule, now.year - 1, &other, &tz_from);
+        }
+        tz_next = first;
+    }
+    else if (utc < second)
+    {
+        tz_dst = firstIsStart;
+        tz_from = first;
+        tz_next = second;
+    }
+    else
+    {
+        tz_dst = !firstIsStart;
+        tz_from = second;
+        tz_next = TZ_NEVER;
+        if (now.year < 99)
+        {
+            I2C_RTC_TZ_changes(&rule, now.year + 1, &tz_next, &other);
+        }
+    }
+    tz_offset = (tz_dst ? rule.dstOffset : rule.stdOffset) * 60L;
+}
+
+void I2C_RTC_TZ_init(const struct I2C_RTC_TZ_rule *rule)
+{
+    tz_rule = rule;
+    tz_from = TZ_NEVER;                 // evaluated with the first conversion
+    tz_next = 0;
+}
+
+uint32_t I2C_RTC_TZ_local(uint32_t utc)
+{
+    if ((utc >= tz_next) || (utc < tz_from))
+    {
+        I2C_RTC_TZ_update(utc);         // change reached or time set back
+    }
+    return utc + tz_offset;
+}
+
+void I2C_RTC_TZ_toLocal(const struct rtc_datetime *utc, struct rtc_datetime *local)
+{
+    uint8_t status = utc->status;
+
+    I2C_RTC_fromEpoch(I2C_RTC_TZ_local(I2C_RTC_toEpoch(utc)), local);
+    local->status = status;
+}
+
+uint8_t I2C_RTC_TZ_isDST(void)
+{
+    return tz_dst;
+}
+
+/**
+ * This file is part of I2C_RTC_TZ Library
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
@@ -0,0 +1,108 @@
+/**
+ * @file I2C_RTC_TZ.h
+ *
+ * @author ClefaMedia
+ *
+ * @version 1.0
+ *
+ * @copyright
+ * Copyright (C) ClefaMedia 2021.
+ * All Rights GNU GLP Licensed.
+ *
+ * @brief This library was created to show the local time
+ * while the RTC (I2C_RTC) runs in UTC.
+ *
+ * A timezone is a rule in the flash: offset of the standard and the
+ * daylight saving time and the days (f.e. last Sunday of March) and
+ * local times of the changes. The rule is only evaluated for the next
+ * change, until then a conversion is a compare and an add. When the
+ * change is reached (or the time jumps back before the last one),
+ * the next change is calculated again.
+ */
+
+
+#ifndef _I2C_RTC_TZ_H                   // prevents duplicate
+#define _I2C_RTC_TZ_H   1               // forward declarations
+
+#include <avr/io.h>                     // requires AVR Input/Output
+#include <avr/pgmspace.h>               // requires PROGMEM
+#include <inttypes.h>                   // requires Inttypes
+#include "I2C_RTC.h"
+
+// week of a change: 1 - 4 or the last one of the month
+#define I2C_RTC_TZ_LAST     5
+
+/** @brief timezone with daylight saving time (month 0: none) */
+struct I2C_RTC_TZ_rule
+{
+    int16_t stdOffset;                  // standard time - UTC in minutes
+    int16_t dstOffset;                  // daylight saving time - UTC in minutes
+    uint8_t startMonth;                 // month 1 - 12 of the change to DST (0 = no DST)
+    uint8_t startWeek;                  // week 1 - 4 or I2C_RTC_TZ_LAST
+    uint8_t startWeekday;               // weekday 1 (Monday) - 7 (Sunday)
+    uint8_t startHour;                  // hour of the change in standard time
+    uint8_t endMonth;                   // month 1 - 12 of the change back
+    uint8_t endWeek;                    // week 1 - 4 or I2C_RTC_TZ_LAST
+    uint8_t endWeekday;                 // weekday 1 (Monday) - 7 (Sunday)
+    uint8_t endHour;                    // hour of the change in daylight saving time
+};
+
+/** @brief UTC */
+extern const struct I2C_RTC_TZ_rule I2C_RTC_TZ_utc;
+/** @brief central european time (CET / CEST) */
+extern const struct I2C_RTC_TZ_rule I2C_RTC_TZ_cet;
+/** @brief british time (GMT / BST) */
+extern const struct I2C_RTC_TZ_rule I2C_RTC_TZ_uk;
+/** @brief US eastern time (EST / EDT, rule since 2007) */
+extern const struct I2C_RTC_TZ_rule I2C_RTC_TZ_usEastern;
+
+/** ===================================================
+ * @brief function to set the timezone
+ *
+ * @param rule timezone in PROGMEM, f.e. &I2C_RTC_TZ_cet
+ */
+void I2C_RTC_TZ_init(const struct I2C_RTC_TZ_rule *rule);
+
+/** ===================================================
+ * @brief function to convert UTC to local time
+ *
+ * @param utc epoch seconds in UTC (I2C_RTC_toEpoch)
+ * @return epoch seconds in local time
+ */
+uint32_t I2C_RTC_TZ_local(uint32_t utc);
+
+/** ===================================================
+ * @brief function to convert date and time from UTC to local time
+ *
+ * @param utc date and time in UTC
+ * @param local date and time in local time
+ */
+void I2C_RTC_TZ_toLocal(const struct rtc_datetime *utc, struct rtc_datetime *local);
+
+/** ===================================================
+ * @brief function to check for daylight saving time
+ * at the last conversion
+ *
+ * @return 1 daylight saving time, 0 standard time
+ */
+uint8_t I2C_RTC_TZ_isDST(void);
+
+#endif                               // end prevent duplicate forward
+/* _I2C_RTC_TZ_H */                  // declarations block
+
+/**
+ * This file is part of I2C_RTC_TZ Library
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */